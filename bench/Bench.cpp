@@ -0,0 +1,262 @@
+#include "../incs/classes/Bench.hpp"
+
+#include <iostream>				// std::cout, std::cerr
+#include <sstream>				// std::ostringstream
+#include <cerrno>				// errno
+#include <cstring>				// memset(), strerror()
+#include <ctime>				// clock_gettime()
+#include <unistd.h>				// close()
+#include <fcntl.h>				// fcntl()
+#include <netdb.h>				// getaddrinfo()
+#include <sys/socket.h>			// socket(), connect(), recv()
+#include <netinet/tcp.h>		// TCP_NODELAY
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+BenchClient::BenchClient(int fd, size_t index) :
+	fd(fd),
+	index(index),
+	state(CONNECTING),
+	input(),
+	output(bench::SENDQ_MAX),
+	waitingWritable(false),
+	connectedAt(0),
+	pendingSince(0),
+	nextSend(0) {}
+
+// --- PRIVATE
+BenchClient::BenchClient(const BenchClient& src) : output(bench::SENDQ_MAX) {(void) src;}
+BenchClient& BenchClient::operator=(const BenchClient& src) {(void) src; return *this;}
+
+// --- PUBLIC
+Bench::Bench(const BenchConfig& config) :
+	_config(config),
+	_poller(NULL),
+	_events(),
+	_opened(0),
+	_registered(0),
+	_closed(0),
+	_errors(0),
+	_completed(0),
+	_sent(0),
+	_expected(0),
+	_delivered(0) {
+	std::memset(&_address, 0, sizeof(_address));
+}
+
+Bench::~Bench() {
+	for (size_t i = 0; i < _clients.size(); ++i) {
+		if (_clients[i]->fd >= 0)
+			close(_clients[i]->fd);
+		delete _clients[i];
+	}
+	delete _poller;
+}
+
+// --- PRIVATE
+Bench::Bench() {}
+Bench::Bench(const Bench& src) {(void) src;}
+Bench& Bench::operator=(const Bench& src) {(void) src; return *this;}
+
+
+// === CLOCK ===
+
+/**
+ * @brief Monotonic clock in microseconds, the unit of every latency of the bench.
+ */
+unsigned long Bench::now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<unsigned long>(ts.tv_sec) * 1000000UL + static_cast<unsigned long>(ts.tv_nsec) / 1000UL;
+}
+
+
+// === CONNECTIONS ===
+
+std::string Bench::_number(unsigned long value) {
+	std::ostringstream oss;
+	oss << value;
+	return oss.str();
+}
+
+/**
+ * @brief Resolves the server address once, every connection reuses it.
+ */
+bool Bench::_resolve() {
+
+	struct addrinfo hints;
+	struct addrinfo* res = NULL;
+
+	std::memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_INET;
+	hints.ai_socktype = SOCK_STREAM;
+
+	int status = getaddrinfo(_config.host.c_str(), NULL, &hints, &res);
+	if (status != 0 || res == NULL) {
+		std::cerr << "ircbench: cannot resolve " << _config.host << ": " << gai_strerror(status) << std::endl;
+		return false;
+	}
+	std::memcpy(&_address, res->ai_addr, sizeof(_address));
+	_address.sin_port = htons(static_cast<unsigned short>(_config.port));
+	freeaddrinfo(res);
+	return true;
+}
+
+/**
+ * @brief Starts a non-blocking connection for the client `index`.
+ *
+ * The socket is watched for writing: it becomes writable once connect() completes,
+ * registration is then sent by _onWritable().
+ */
+bool Bench::_openConnection(size_t index) {
+
+	int fd = socket(AF_INET, SOCK_STREAM, 0);
+	if (fd < 0) {
+		std::cerr << "ircbench: socket: " << std::strerror(errno) << std::endl;
+		return false;
+	}
+	int one = 1;
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	fcntl(fd, F_SETFL, O_NONBLOCK);
+
+	if (connect(fd, reinterpret_cast<struct sockaddr*>(&_address), sizeof(_address)) < 0 && errno != EINPROGRESS) {
+		std::cerr << "ircbench: connect: " << std::strerror(errno) << std::endl;
+		close(fd);
+		return false;
+	}
+	if (!_poller->add(fd, poll_event::READ | poll_event::WRITE)) {
+		std::cerr << "ircbench: too many descriptors for the " << _poller->name() << " backend" << std::endl;
+		close(fd);
+		return false;
+	}
+
+	BenchClient* client = new BenchClient(fd, index);
+	client->connectedAt = now();
+	_clients.push_back(client);
+	_byFd[fd] = client;
+	++_opened;
+	return true;
+}
+
+/**
+ * @brief One turn of the event loop: waits at most `timeoutMs` and serves ready sockets.
+ */
+void Bench::_pump(int timeoutMs) {
+
+	if (_poller->wait(_events, timeoutMs) < 0) {
+		std::cerr << "ircbench: poller: " << std::strerror(errno) << std::endl;
+		return;
+	}
+	for (size_t i = 0; i < _events.size(); ++i) {
+		std::map<int, BenchClient*>::iterator it = _byFd.find(_events[i].fd);
+		if (it == _byFd.end())
+			continue;
+		BenchClient& client = *it->second;
+		if (_events[i].events & poll_event::WRITE)
+			_onWritable(client);
+		if (client.state != BenchClient::CLOSED && (_events[i].events & poll_event::READ))
+			_onReadable(client);
+	}
+}
+
+void Bench::_onWritable(BenchClient& client) {
+
+	if (client.state == BenchClient::CONNECTING) {
+		int error = 0;
+		socklen_t length = sizeof(error);
+		if (getsockopt(client.fd, SOL_SOCKET, SO_ERROR, &error, &length) < 0 || error != 0) {
+			_close(client);
+			return;
+		}
+		// Plus besoin d'être réveillé en écriture tant que rien n'est en attente (select est level-triggered)
+		_poller->modify(client.fd, poll_event::READ);
+		client.state = BenchClient::REGISTERING;
+		client.nick = "b" + _number(client.index);
+		_send(client, "PASS " + _config.password);
+		_send(client, "NICK " + client.nick);
+		_send(client, "USER " + client.nick + " 0 * :ircbench");
+		return;
+	}
+	if (!client.waitingWritable)
+		return;
+	client.waitingWritable = false;
+	_flush(client);
+	if (client.state != BenchClient::CLOSED && !client.waitingWritable)
+		_poller->modify(client.fd, poll_event::READ);
+}
+
+/**
+ * @brief Reads until EAGAIN (edge-triggered poller) and handles every complete line.
+ */
+void Bench::_onReadable(BenchClient& client) {
+
+	while (true) {
+		size_t available = 0;
+		char* buffer = client.input.prepareWrite(available);
+		ssize_t received = recv(client.fd, buffer, available, 0);
+
+		if (received < 0) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				break;
+			if (errno == EINTR)
+				continue;
+			_close(client);
+			return;
+		}
+		if (received == 0) {
+			_close(client);
+			return;
+		}
+		client.input.commitWrite(static_cast<size_t>(received));
+
+		const char* line = NULL;
+		size_t length = 0;
+		while (client.state != BenchClient::CLOSED && client.input.nextLine(line, length))
+			_handleLine(client, line, length);
+		if (client.state == BenchClient::CLOSED)
+			return;
+	}
+}
+
+void Bench::_flush(BenchClient& client) {
+
+	if (client.state == BenchClient::CLOSED || client.waitingWritable)
+		return;
+
+	switch (client.output.flush(client.fd)) {
+		case SendQueue::FLUSH_DONE:
+			break;
+		case SendQueue::FLUSH_PENDING:
+			client.waitingWritable = true;
+			_poller->modify(client.fd, poll_event::READ | poll_event::WRITE);
+			break;
+		case SendQueue::FLUSH_ERROR:
+			_close(client);
+			break;
+	}
+}
+
+void Bench::_close(BenchClient& client) {
+
+	if (client.state == BenchClient::CLOSED)
+		return;
+	client.state = BenchClient::CLOSED;
+	_poller->remove(client.fd);
+	_byFd.erase(client.fd);
+	close(client.fd);
+	client.fd = -1;
+	client.output.clear();
+	++_closed;
+}
+
+/**
+ * @brief Queues one IRC line and writes it right away (latency is what is measured).
+ */
+void Bench::_send(BenchClient& client, const std::string& line) {
+
+	if (client.state == BenchClient::CLOSED)
+		return;
+	client.output.push(SharedBuffer(line + "\r\n"));
+	_flush(client);
+}
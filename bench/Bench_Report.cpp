@@ -0,0 +1,69 @@
+#include "../incs/classes/Bench.hpp"
+
+#include <iostream>				// std::cout
+#include <sstream>				// std::ostringstream
+#include <iomanip>				// std::setprecision, std::setw
+
+// =========================================================================================
+// === REPORT ===
+
+/**
+ * @brief Formats a duration in microseconds with a readable unit (us, ms, s).
+ */
+std::string Bench::_formatUs(unsigned long us) {
+
+	std::ostringstream oss;
+	oss << std::fixed << std::setprecision(2);
+	if (us < 1000)
+		oss << us << " us";
+	else if (us < 1000000)
+		oss << us / 1e3 << " ms";
+	else
+		oss << us / 1e6 << " s";
+	return oss.str();
+}
+
+void Bench::_printLatency(const std::string& label, const LatencyHistogram& histogram) const {
+
+	std::cout << std::left << std::setw(14) << label << ": ";
+	if (histogram.count() == 0) {
+		std::cout << "no sample" << std::endl;
+		return;
+	}
+	std::cout << "p50 " << _formatUs(histogram.percentile(50))
+		<< "  p99 " << _formatUs(histogram.percentile(99))
+		<< "  p999 " << _formatUs(histogram.percentile(99.9))
+		<< "  max " << _formatUs(histogram.max())
+		<< "  (" << histogram.count() << " samples)" << std::endl;
+}
+
+/**
+ * @brief Prints the results of the run on stdout.
+ *
+ * Throughput is computed over the load phase only (the join storm for the join
+ * workload); the drain time after the last send is included, so a server that falls
+ * behind shows up as a lower delivery rate and not only as a higher latency.
+ */
+void Bench::_report(double connectSeconds, double loadSeconds) const {
+
+	double seconds = loadSeconds > 0 ? loadSeconds : 1;
+
+	std::cout << std::fixed << std::setprecision(1);
+	std::cout << "ircbench: " << _config.workload << " workload, " << _config.clients << " clients, "
+		<< _config.channels << " channels, " << _config.rate << " msg/s/client, "
+		<< _config.duration << " s (" << _poller->name() << ")" << std::endl;
+
+	std::cout << std::left << std::setw(14) << "connections" << ": "
+		<< _registered << "/" << _config.clients << " registered in " << connectSeconds << " s"
+		<< " (closed " << _closed << ", errors " << _errors << ")" << std::endl;
+	_printLatency("registration", _registerLatency);
+
+	if (_config.workload == "join")
+		seconds = _latency.max() > 0 ? _latency.max() / 1e6 : 1;
+
+	std::cout << std::left << std::setw(14) << "sent" << ": "
+		<< _sent << " in " << seconds << " s (" << _sent / seconds << "/s)" << std::endl;
+	std::cout << std::left << std::setw(14) << "delivered" << ": "
+		<< _delivered << "/" << _expected << " (" << _delivered / seconds << "/s)" << std::endl;
+	_printLatency("latency", _latency);
+}
@@ -0,0 +1,282 @@
+#include "../incs/classes/Bench.hpp"
+
+#include <iostream>				// std::cout, std::cerr
+#include <cstdlib>				// strtoul(), rand()
+
+// =========================================================================================
+// === RUN ===
+
+/**
+ * @brief Runs the whole benchmark: connections, setup, workload, report.
+ *
+ * @return int The exit status of ircbench (1 if no client could register).
+ */
+int Bench::run() {
+
+	if (!_resolve())
+		return 1;
+	_poller = Poller::create();
+	_events.reserve(server::POLL_MAX_EVENTS);
+
+	unsigned long start = now();
+	if (!_connectAll())
+		return 1;
+	double connectSeconds = (now() - start) / 1e6;
+
+	if (_config.workload == "join" || _config.workload == "fanout") {
+		if (!_joinAll())
+			return 1;
+	}
+
+	start = now();
+	_runLoad();
+	double loadSeconds = (now() - start) / 1e6;
+
+	_report(connectSeconds, loadSeconds);
+	return 0;
+}
+
+
+// === SETUP ===
+
+/**
+ * @brief Opens every connection and waits until they are all registered.
+ *
+ * At most `connectBatch` connections are in progress at once: the listen backlog of
+ * the server is never overrun, and the registration latency measures the server, not
+ * a SYN queue. Stops early if the system refuses new descriptors.
+ *
+ * @return bool false if no client could register.
+ */
+bool Bench::_connectAll() {
+
+	unsigned long deadline = now() + bench::SETUP_TIMEOUT * 1000000UL;
+	size_t next = 0;
+
+	while (next < _config.clients || _registered + _closed < _opened) {
+
+		while (next < _config.clients && _opened - _registered - _closed < _config.connectBatch) {
+			if (!_openConnection(next)) {
+				std::cerr << "ircbench: stopping at " << next << " connections" << std::endl;
+				_config.clients = next;
+				break;
+			}
+			++next;
+		}
+		_pump(10);
+
+		if (now() > deadline) {
+			std::cerr << "ircbench: registration timed out (" << _registered << "/" << _opened << ")" << std::endl;
+			break;
+		}
+	}
+	return _registered > 0;
+}
+
+/**
+ * @brief Name of the channel `number`: ircserv only accepts letters in channel names,
+ * so the number is written in base 26 (#bencha, #benchb, ..., #benchba...).
+ */
+std::string Bench::_channelName(size_t number) {
+	std::string suffix;
+	do {
+		suffix.insert(suffix.begin(), static_cast<char>('a' + number % 26));
+		number /= 26;
+	} while (number);
+	return "#bench" + suffix;
+}
+
+/**
+ * @brief Every registered client joins its channel (number index % channels).
+ *
+ * For the join workload this storm is the measured workload itself: each JOIN is timed
+ * until the end of its NAMES reply (366). The other workloads only need the membership.
+ */
+bool Bench::_joinAll() {
+
+	unsigned long start = now();
+	unsigned long deadline = start + bench::SETUP_TIMEOUT * 1000000UL;
+	size_t expected = 0;
+
+	for (size_t i = 0; i < _clients.size(); ++i) {
+		BenchClient& client = *_clients[i];
+		if (client.state != BenchClient::READY)
+			continue;
+		client.channel = _channelName(client.index % _config.channels);
+		client.pendingSince = now();
+		_send(client, "JOIN " + client.channel);
+		++expected;
+	}
+	_sent = expected;
+	_expected = expected;
+
+	while (_completed < expected && now() < deadline)
+		_pump(10);
+
+	if (_completed < expected)
+		std::cerr << "ircbench: join timed out (" << _completed << "/" << expected << ")" << std::endl;
+	return _completed > 0;
+}
+
+
+// === WORKLOAD ===
+
+/**
+ * @brief Sends the workload for `duration` seconds, then waits for the last deliveries.
+ *
+ * Every client sends at `rate` messages per second; the first sends are spread over one
+ * interval so the clients do not fire in lockstep.
+ */
+void Bench::_runLoad() {
+
+	// Le join storm a déjà été mesuré par _joinAll()
+	if (_config.workload == "join")
+		return;
+
+	_latency.reset();
+	_completed = 0;
+	_sent = 0;
+	_expected = 0;
+	_delivered = 0;
+
+	unsigned long start = now();
+	unsigned long end = start + static_cast<unsigned long>(_config.duration) * 1000000UL;
+	unsigned long interval = static_cast<unsigned long>(1000000.0 / _config.rate);
+	if (interval == 0)
+		interval = 1;
+
+	for (size_t i = 0; i < _clients.size(); ++i)
+		_clients[i]->nextSend = start + interval * i / _clients.size();
+
+	for (unsigned long t = start; t < end; t = now()) {
+		for (size_t i = 0; i < _clients.size(); ++i) {
+			BenchClient& client = *_clients[i];
+			if (client.state != BenchClient::READY || client.nextSend > t)
+				continue;
+			_sendLoad(client, t);
+			client.nextSend += interval;
+		}
+		_pump(1);
+	}
+
+	// Attente des messages encore en vol
+	unsigned long deadline = now() + bench::DRAIN_TIMEOUT * 1000000UL;
+	while (_delivered < _expected && now() < deadline)
+		_pump(10);
+}
+
+/**
+ * @brief Sends one unit of work for a client, according to the workload.
+ *
+ * Messages carry their send time ("bench <us>"), so any receiver measures the delivery
+ * latency. Each one is counted as many times as it is expected to be delivered.
+ */
+void Bench::_sendLoad(BenchClient& client, unsigned long t) {
+
+	std::string stamp = " :" + bench::MESSAGE_TAG + " " + _number(t);
+
+	if (_config.workload == "fanout") {
+		size_t members = _channelMembers[client.channel];
+		if (members < 2)
+			return;
+		_send(client, "PRIVMSG " + client.channel + stamp);
+		_expected += members - 1;
+	}
+	else if (_config.workload == "privmsg") {
+		if (_clients.size() < 2)
+			return;
+		size_t offset = 1 + static_cast<size_t>(std::rand()) % (_clients.size() - 1);
+		const BenchClient& target = *_clients[(client.index + offset) % _clients.size()];
+		if (target.state != BenchClient::READY)
+			return;
+		_send(client, "PRIVMSG " + target.nick + stamp);
+		++_expected;
+	}
+	else if (_config.workload == "nick") {
+		// Une seule requête NICK en vol par client
+		if (client.pendingSince)
+			return;
+		client.pendingNick = (client.nick[0] == 'b' ? "c" : "b") + _number(client.index);
+		client.pendingSince = t;
+		_send(client, "NICK " + client.pendingNick);
+		++_expected;
+	}
+	++_sent;
+}
+
+
+// === REPLIES ===
+
+/**
+ * @brief Handles one line received by a simulated client.
+ *
+ * Only what the bench measures is parsed: registration (001), end of JOIN (366),
+ * timestamped PRIVMSG, echo of our own NICK, errors, and PING to stay connected.
+ */
+void Bench::_handleLine(BenchClient& client, const char* line, size_t length) {
+
+	std::string message(line, length);
+	std::string prefix;
+	size_t pos = 0;
+
+	if (!message.empty() && message[0] == ':') {
+		pos = message.find(' ');
+		if (pos == std::string::npos)
+			return;
+		prefix = message.substr(1, pos - 1);
+		++pos;
+	}
+	size_t end = message.find(' ', pos);
+	std::string command = message.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+
+	if (command == "PING") {
+		_send(client, "PONG" + (end == std::string::npos ? std::string() : message.substr(end)));
+	}
+	else if (command == "001") {
+		if (client.state != BenchClient::REGISTERING)
+			return;
+		client.state = BenchClient::READY;
+		_registerLatency.record(now() - client.connectedAt);
+		++_registered;
+	}
+	else if (command == "366") {
+		// Fin de NAMES : dernière ligne de la réponse au JOIN
+		if (!client.pendingSince)
+			return;
+		_latency.record(now() - client.pendingSince);
+		client.pendingSince = 0;
+		++_channelMembers[client.channel];
+		++_completed;
+		++_delivered;
+	}
+	else if (command == "PRIVMSG") {
+		std::string tag = " :" + bench::MESSAGE_TAG + " ";
+		size_t stamp = message.find(tag, end);
+		if (stamp == std::string::npos)
+			return;
+		unsigned long sentAt = std::strtoul(message.c_str() + stamp + tag.size(), NULL, 10);
+		unsigned long t = now();
+		_latency.record(t > sentAt ? t - sentAt : 0);
+		++_delivered;
+	}
+	else if (command == "NICK") {
+		// Seul l'écho de notre propre changement termine la requête
+		if (!client.pendingSince || prefix.substr(0, prefix.find('!')) != client.nick)
+			return;
+		_latency.record(now() - client.pendingSince);
+		client.nick = client.pendingNick;
+		client.pendingSince = 0;
+		++_completed;
+		++_delivered;
+	}
+	else if (command == "ERROR") {
+		_close(client);
+	}
+	else if (command.size() == 3 && (command[0] == '4' || command[0] == '5')) {
+		++_errors;
+		if (client.state == BenchClient::REGISTERING)
+			_close(client);
+		else if (_config.workload == "nick")
+			client.pendingSince = 0;
+	}
+}
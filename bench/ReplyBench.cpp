@@ -0,0 +1,167 @@
+// === CLASSES ===
+#include "../incs/classes/MessageHandler.hpp"
+#include "../incs/classes/SharedBuffer.hpp"
+
+#include <iostream>				// std::cout, std::cerr
+#include <iomanip>				// std::setw(), std::setprecision()
+#include <cstdlib>				// strtol()
+#include <time.h>				// clock_gettime()
+
+// === NAMESPACES ===
+using namespace irc_replies;
+using namespace colors;
+
+// =========================================================================================
+/**
+ * Microbenchmark of the reply formatting: each reply is built by MessageHandler
+ * (ReplyBuilder) and by the std::ostringstream code it replaced, kept below as reference.
+ * Both versions must produce the same bytes, the run stops otherwise.
+ *
+ * Usage: ./replybench [iterations]
+ */
+
+// === REFERENCE : ANCIENS BUILDERS (std::ostringstream) ===
+
+static std::string refNameReply(const std::string& nickname, const std::string& channelName, const std::string& users) {
+	std::ostringstream stream;
+	stream	<< ":" << server::NAME << " " << "353" << " " << nickname << " = " << channelName << " :" << users << eol::IRC;
+	stream	<< ":" << server::NAME << " " << "366" << " " << nickname << " " << channelName << " :" << RPL_ENDOFNAMES_MSG;
+	return stream.str();
+}
+
+static std::string refWho(const std::string& nickname, const std::string& targetNick, const std::string& username,
+	const std::string& realname, const std::string& clientIp, const std::string& channelName, bool isAway) {
+	std::string awayChar = isAway ? "G" : "H";
+	std::ostringstream stream;
+	stream << ":" << server::NAME << " " << "352" << " " << nickname << " "
+	<< channelName << " " << username << " " << clientIp << " " << server::NAME << " "
+	<< targetNick << " " << awayChar << " :" << 0 << " " << realname << eol::IRC;
+	return stream.str();
+}
+
+static std::string refWelcome(const std::string& nickname, const std::string& usermask) {
+	std::ostringstream stream;
+	stream << ":" << server::NAME << " " << "001" << " " << nickname
+	<< " :" << IRC_COLOR_INFO << RPL_WELCOME_MSG << IRC_RESET << " " << usermask;
+	return stream.str();
+}
+
+static std::string refNeedMoreParams(const std::string& nickname, const std::string& command) {
+	std::ostringstream stream;
+	stream << ":" << server::NAME << " " << "461" << " " << nickname << " " << command
+	<< " :" << IRC_COLOR_ERR << ERR_NEEDMOREPARAMS_MSG << IRC_RESET;
+	return stream.str();
+}
+
+static std::string refTopicWhoTime(const std::string& nickname, const std::string& setterNick, const std::string& channelName, time_t topicTime) {
+	std::ostringstream stream;
+	stream << ":" << server::NAME << " " << "333" << " " << nickname << " " << channelName << " " << setterNick
+	<< " " << topicTime;
+	return stream.str();
+}
+
+static std::string refFormat(const std::string& message) {
+	if (message.length() > server::BUFFER_SIZE)
+		return message.substr(0, server::BUFFER_SIZE) + eol::IRC;
+	return message + eol::IRC;
+}
+
+
+// === CAS MESURÉS ===
+
+static const std::string NICK = "benchnick42";
+static const std::string CHANNEL = "#benchmark";
+static const std::string USERS = "@alice bob carol dave eve frank grace heidi ivan judy mallory oscar peggy";
+static const time_t TOPIC_TIME = 1718000000;
+
+struct ReplyCase {
+	const char* name;
+	std::string (*reference)();
+	std::string (*current)();
+};
+
+static std::string nameReplyRef() { return refNameReply(NICK, CHANNEL, USERS); }
+static std::string nameReplyNew() {
+	return MessageHandler::ircNameReply(NICK, CHANNEL, USERS) + eol::IRC + MessageHandler::ircEndOfNames(NICK, CHANNEL);
+}
+static std::string whoRef() { return refWho(NICK, "alice", "~alice", "Alice Liddell", "127.0.0.1", CHANNEL, false); }
+static std::string whoNew() { return MessageHandler::ircWho(NICK, "alice", "~alice", "Alice Liddell", "127.0.0.1", CHANNEL, false); }
+static std::string welcomeRef() { return refWelcome(NICK, NICK + "!~bench@127.0.0.1"); }
+static std::string welcomeNew() { return MessageHandler::ircWelcomeMessage(NICK, NICK + "!~bench@127.0.0.1"); }
+static std::string needMoreParamsRef() { return refNeedMoreParams(NICK, "JOIN"); }
+static std::string needMoreParamsNew() { return MessageHandler::ircNeedMoreParams(NICK, "JOIN"); }
+static std::string topicWhoTimeRef() { return refTopicWhoTime(NICK, "alice", CHANNEL, TOPIC_TIME); }
+static std::string topicWhoTimeNew() { return MessageHandler::ircTopicWhoTime(NICK, "alice", CHANNEL, TOPIC_TIME); }
+
+// Ligne complète jusqu'au buffer partagé mis en file (Client::sendMessage)
+static std::string wireRef() {
+	SharedBuffer buffer(refFormat(refNeedMoreParams(NICK, "JOIN")));
+	return std::string(buffer.data(), buffer.size());
+}
+static std::string wireNew() {
+	std::string wire = MessageHandler::ircFormat(MessageHandler::ircNeedMoreParams(NICK, "JOIN"));
+	SharedBuffer buffer = SharedBuffer::adopt(wire);
+	return std::string(buffer.data(), buffer.size());
+}
+
+static const ReplyCase CASES[] = {
+	{ "353+366 NAMES", nameReplyRef, nameReplyNew },
+	{ "352 WHO", whoRef, whoNew },
+	{ "001 WELCOME", welcomeRef, welcomeNew },
+	{ "461 NEEDMOREPARAMS", needMoreParamsRef, needMoreParamsNew },
+	{ "333 TOPICWHOTIME", topicWhoTimeRef, topicWhoTimeNew },
+	{ "461 + wire buffer", wireRef, wireNew }
+};
+
+
+// === MESURE ===
+
+static double nowNs() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Durée moyenne d'un appel (ns)
+static double measure(std::string (*build)(), long iterations, size_t& sink) {
+	double start = nowNs();
+	for (long i = 0; i < iterations; ++i)
+		sink += build().size();
+	return (nowNs() - start) / iterations;
+}
+
+int main(int argc, char** argv) {
+
+	long iterations = 1000000;
+	if (argc > 1) {
+		char* end = NULL;
+		iterations = std::strtol(argv[1], &end, 10);
+		if (!*argv[1] || *end != '\0' || iterations <= 0) {
+			std::cerr << "Usage: ./replybench [iterations]" << std::endl;
+			return 1;
+		}
+	}
+
+	size_t sink = 0;
+	const size_t count = sizeof(CASES) / sizeof(CASES[0]);
+
+	std::cout << std::left << std::setw(22) << "reply" << std::right
+		<< std::setw(16) << "ostringstream" << std::setw(16) << "ReplyBuilder" << std::setw(10) << "speedup" << std::endl;
+
+	for (size_t i = 0; i < count; ++i) {
+		if (CASES[i].reference() != CASES[i].current()) {
+			std::cerr << "replybench: " << CASES[i].name << ": output differs from the reference" << std::endl;
+			return 1;
+		}
+		// Un tour à vide pour chauffer les caches et l'allocateur
+		measure(CASES[i].reference, iterations / 10 + 1, sink);
+		measure(CASES[i].current, iterations / 10 + 1, sink);
+
+		double reference = measure(CASES[i].reference, iterations, sink);
+		double current = measure(CASES[i].current, iterations, sink);
+		std::cout << std::left << std::setw(22) << CASES[i].name << std::right << std::fixed << std::setprecision(1)
+			<< std::setw(13) << reference << " ns" << std::setw(13) << current << " ns"
+			<< std::setw(9) << reference / current << "x" << std::endl;
+	}
+	return sink == 0;
+}
@@ -0,0 +1,118 @@
+#include "../incs/classes/Bench.hpp"
+
+#include <iostream>				// std::cout, std::cerr
+#include <cstdlib>				// strtol(), strtod()
+#include <csignal>				// signal()
+#include <sys/resource.h>		// getrlimit(), setrlimit()
+
+/**
+ * @brief Prints the command line of ircbench.
+ */
+static void usage() {
+	std::cerr << "Usage: ./ircbench <host> <port> <password> [options]" << std::endl
+		<< "  -w <workload>   join | fanout | privmsg | nick (default fanout)" << std::endl
+		<< "  -c <clients>    number of connections (default " << bench::DEFAULT_CLIENTS << ")" << std::endl
+		<< "  -C <channels>   number of channels for join/fanout (default " << bench::DEFAULT_CHANNELS << ")" << std::endl
+		<< "  -r <rate>       messages per second per client (default " << bench::DEFAULT_RATE << ")" << std::endl
+		<< "  -d <seconds>    duration of the workload (default " << bench::DEFAULT_DURATION << ")" << std::endl
+		<< "  -b <batch>      connections in progress at once (default " << bench::CONNECT_BATCH << ")" << std::endl;
+}
+
+/**
+ * @brief Parses a strictly positive integer option.
+ */
+static bool parsePositive(const char* arg, long max, long& value) {
+	char* end = NULL;
+	value = std::strtol(arg, &end, 10);
+	return *arg && *end == '\0' && value > 0 && value <= max;
+}
+
+/**
+ * @brief Parses the command line into `config`.
+ *
+ * @return bool false (after printing the usage) if an argument is invalid.
+ */
+static bool parse(int argc, char** argv, BenchConfig& config) {
+
+	long value = 0;
+
+	if (argc < 4 || !parsePositive(argv[2], 65535, value)) {
+		usage();
+		return false;
+	}
+	config.host = argv[1];
+	config.port = static_cast<int>(value);
+	config.password = argv[3];
+	config.workload = "fanout";
+	config.clients = bench::DEFAULT_CLIENTS;
+	config.channels = bench::DEFAULT_CHANNELS;
+	config.rate = bench::DEFAULT_RATE;
+	config.duration = bench::DEFAULT_DURATION;
+	config.connectBatch = bench::CONNECT_BATCH;
+
+	for (int i = 4; i < argc; i += 2) {
+		std::string option = argv[i];
+		if (i + 1 >= argc) {
+			usage();
+			return false;
+		}
+		const char* arg = argv[i + 1];
+		bool valid = true;
+
+		if (option == "-w") {
+			config.workload = arg;
+			valid = config.workload == "join" || config.workload == "fanout"
+				|| config.workload == "privmsg" || config.workload == "nick";
+		}
+		else if (option == "-c" && (valid = parsePositive(arg, 1000000, value)))
+			config.clients = static_cast<size_t>(value);
+		else if (option == "-C" && (valid = parsePositive(arg, 100000, value)))
+			config.channels = static_cast<size_t>(value);
+		else if (option == "-d" && (valid = parsePositive(arg, 86400, value)))
+			config.duration = static_cast<int>(value);
+		else if (option == "-b" && (valid = parsePositive(arg, 100000, value)))
+			config.connectBatch = static_cast<size_t>(value);
+		else if (option == "-r") {
+			char* end = NULL;
+			config.rate = std::strtod(arg, &end);
+			valid = *arg && *end == '\0' && config.rate > 0;
+		}
+		else if (option != "-c" && option != "-C" && option != "-d" && option != "-b")
+			valid = false;
+
+		if (!valid) {
+			std::cerr << "ircbench: invalid option " << option << " " << arg << std::endl;
+			usage();
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Raises the descriptor limit as far as allowed: one socket per simulated client.
+ */
+static void raiseDescriptorLimit(size_t clients) {
+	struct rlimit limit;
+	if (getrlimit(RLIMIT_NOFILE, &limit) < 0)
+		return;
+	rlim_t wanted = static_cast<rlim_t>(clients) + 64;
+	if (limit.rlim_cur >= wanted)
+		return;
+	limit.rlim_cur = (limit.rlim_max == RLIM_INFINITY || limit.rlim_max >= wanted) ? wanted : limit.rlim_max;
+	setrlimit(RLIMIT_NOFILE, &limit);
+}
+
+int main(int argc, char** argv) {
+
+	BenchConfig config;
+	if (!parse(argc, argv, config))
+		return 1;
+
+	// Un serveur qui ferme une connexion ne doit pas tuer le bench
+	signal(SIGPIPE, SIG_IGN);
+	raiseDescriptorLimit(config.clients);
+
+	Bench bench(config);
+	return bench.run();
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <string>				// std::string
+#include <vector>				// container vector
+#include <map>					// container map
+#include <netinet/in.h>			// struct sockaddr_in
+
+// === NAMESPACES ===
+#include "../config/irc_config.hpp"
+
+// === CLASSES ===
+#include "Poller.hpp"
+#include "InputBuffer.hpp"
+#include "SendQueue.hpp"
+#include "LatencyHistogram.hpp"
+
+// =========================================================================================
+
+/**
+ * @brief Settings of a benchmark run (command line of ircbench).
+ */
+struct BenchConfig {
+	std::string host;										// Adresse du serveur
+	int port;												// Port du serveur
+	std::string password;									// Mot de passe du serveur
+	std::string workload;									// join, fanout, privmsg ou nick
+	size_t clients;											// Nombre de connexions
+	size_t channels;										// Nombre de canaux (join, fanout)
+	double rate;											// Messages par seconde et par client
+	int duration;											// Durée de la charge (secondes)
+	size_t connectBatch;									// Connexions ouvertes par tour de boucle
+};
+
+/**
+ * @brief One simulated IRC client.
+ */
+struct BenchClient {
+
+	enum State {
+		CONNECTING,											// connect() en cours
+		REGISTERING,										// PASS/NICK/USER envoyés, attente du 001
+		READY,												// Enregistré
+		CLOSED												// Connexion perdue
+	};
+
+	int fd;
+	size_t index;											// Numéro du client (nickname b<index>)
+	State state;
+	std::string nick;										// Pseudo courant
+	std::string pendingNick;								// Pseudo demandé (NICK en attente)
+	std::string channel;									// Canal du client (join, fanout)
+	InputBuffer input;										// Données reçues
+	SendQueue output;										// Lignes en attente d'envoi
+	bool waitingWritable;									// Socket plein
+	unsigned long connectedAt;								// Début de la connexion (us)
+	unsigned long pendingSince;								// Envoi de la requête en attente (JOIN, NICK), 0 si aucune
+	unsigned long nextSend;									// Prochain envoi programmé (us)
+
+	BenchClient(int fd, size_t index);
+
+	private:
+		BenchClient(const BenchClient& src);
+		BenchClient& operator=(const BenchClient& src);
+};
+
+/**
+ * @brief Single-process, event-driven client swarm used to load ircserv.
+ *
+ * All the connections share one poller (the server's own backend). A run has three
+ * phases: connection and registration of every client, an optional setup (JOIN of the
+ * channels), then the workload itself for `duration` seconds. Latencies are measured
+ * by the bench itself: messages carry their send time, requests (JOIN, NICK) are timed
+ * until their reply. Results are kept in log-scale histograms.
+ */
+class Bench {
+
+	private:
+		Bench();
+		Bench(const Bench& src);
+		Bench& operator=(const Bench& src);
+
+		BenchConfig _config;
+		struct sockaddr_in _address;						// Adresse résolue du serveur
+		Poller* _poller;
+		std::vector<PollEvent> _events;
+		std::vector<BenchClient*> _clients;					// Clients par numéro
+		std::map<int, BenchClient*> _byFd;					// Clients par socket
+		std::map<std::string, size_t> _channelMembers;		// Membres de chaque canal
+
+		size_t _opened;										// Connexions ouvertes
+		size_t _registered;									// Clients enregistrés
+		size_t _closed;										// Connexions perdues
+		size_t _errors;										// Réponses d'erreur reçues
+		size_t _completed;									// Requêtes terminées (JOIN, NICK)
+		unsigned long _sent;								// Messages envoyés
+		unsigned long _expected;							// Livraisons attendues
+		unsigned long _delivered;							// Livraisons reçues
+
+		LatencyHistogram _registerLatency;					// Connexion -> 001
+		LatencyHistogram _latency;							// Envoi -> réception (ou requête -> réponse)
+
+		// === CONNECTIONS === (Bench.cpp)
+		static std::string _number(unsigned long value);
+		bool _resolve();
+		bool _openConnection(size_t index);
+		void _pump(int timeoutMs);
+		void _onWritable(BenchClient& client);
+		void _onReadable(BenchClient& client);
+		void _flush(BenchClient& client);
+		void _close(BenchClient& client);
+		void _send(BenchClient& client, const std::string& line);
+
+		// === WORKLOADS === (Bench_Workloads.cpp)
+		static std::string _channelName(size_t number);
+		bool _connectAll();
+		bool _joinAll();
+		void _runLoad();
+		void _sendLoad(BenchClient& client, unsigned long now);
+		void _handleLine(BenchClient& client, const char* line, size_t length);
+
+		// === REPORT === (Bench_Report.cpp)
+		static std::string _formatUs(unsigned long us);
+		void _printLatency(const std::string& label, const LatencyHistogram& histogram) const;
+		void _report(double connectSeconds, double loadSeconds) const;
+
+	public:
+		Bench(const BenchConfig& config);
+		~Bench();
+
+		int run();											// Lance le benchmark, renvoie le code de sortie
+		static unsigned long now();							// Horloge monotone (microsecondes)
+};
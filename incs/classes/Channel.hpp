@@ -2,13 +2,17 @@
 
 #include <iostream>				// gestion chaînes de caractères -> std::cout, std::cerr, std::string
 #include <sstream>				// gestion flux -> std::ostringstream
-#include <set>					// container set
+#include <vector>				// container vector
 
 // === NAMESPACES ===
 #include "../config/irc_config.hpp"
 
 // === CLASSES ===
 #include "MessageHandler.hpp"
+#include "Logger.hpp"
+#include "NicknameIndex.hpp"
+#include "HashMap.hpp"
+#include "ObjectPool.hpp"
 #include "Client.hpp"
 
 // =========================================================================================
@@ -16,6 +20,51 @@
 class Client;
 class Channel {
 
+	public:
+		// === MEMBERSHIP TABLE ===
+		enum MemberFlag {
+			MEMBER = 1,										// Connecté au canal
+			OPERATOR = 2,									// Operator (chef) du canal
+			INVITED = 4										// Invité sur le canal
+		};
+		struct Member {
+			const Client* client;
+			int flags;										// Combinaison de MemberFlag
+		};
+
+		/**
+		 * @brief Forward iterator over the entries of the membership table having a flag.
+		 *
+		 * It reads the table in place: no copy, no allocation. Like any vector iterator,
+		 * it is invalidated when the membership of the channel changes.
+		 */
+		class MemberIterator {
+			public:
+				MemberIterator(const std::vector<Member>& members, size_t index, int flag);
+
+				const Member& operator*() const;
+				const Member* operator->() const;
+				MemberIterator& operator++();
+				bool operator==(const MemberIterator& other) const;
+				bool operator!=(const MemberIterator& other) const;
+
+			private:
+				const std::vector<Member>* _members;
+				size_t _index;
+				int _flag;
+
+				void _skip();								// Avance jusqu'à la prochaine entrée ayant le drapeau
+		};
+
+		/**
+		 * @brief Callback interface of Channel::forEachMember().
+		 */
+		class MemberVisitor {
+			public:
+				virtual ~MemberVisitor() {}
+				virtual void visit(const Client* client, int flags) = 0;
+		};
+
 	private:
 		Channel();
 		Channel(const Channel& src);
@@ -28,9 +77,23 @@ class Channel {
 		time_t _topicTimestamp;								// Date de la dernière modification du sujet format UNIX
 		time_t _channelTimestamp;							// Moment ou a ete cree le channel
 
-		std::set<const Client*> _connected;					// Liste des clients connectés au canal	
-		std::set<const Client*> _operators;					// Liste des operators (chefs) du canal
-		std::set<const Client*> _invited;					// Liste des clients invités au canal
+		// === MEMBERSHIP TABLE ===
+		struct Hash {
+			size_t operator()(const Client* client) const;
+		};
+		struct Equal {
+			bool operator()(const Client* a, const Client* b) const;
+		};
+
+		std::vector<Member> _members;						// Clients liés au canal (membres, operators, invités), contigus
+		HashMap<const Client*, size_t, Hash, Equal> _memberIndex;	// Client -> position dans _members
+		size_t _connectedCount;								// Nombre de membres
+		size_t _operatorCount;								// Nombre d'operators
+		size_t _invitedCount;								// Nombre d'invités
+
+		bool _hasFlag(const Client* client, int flag) const;	// Vérifie un drapeau d'un client
+		bool _setFlag(const Client* client, int flag);			// Pose un drapeau (false s'il était déjà posé)
+		bool _clearFlag(const Client* client, int flag);		// Retire un drapeau (false s'il n'était pas posé)
 		
 		bool _invites; 										// Canal est accessible sur invitation uniquement
 		bool _rightsTopic;
@@ -41,6 +104,11 @@ class Channel {
 		Channel(const std::string &name, const std::string& password);
 		~Channel();
 
+		// === MEMORY POOL ===
+		static void* operator new(size_t size);				// Alloue un canal dans le pool
+		static void operator delete(void* pointer, size_t size);	// Rend l'emplacement au pool
+		static PoolUsage poolUsage();						// Occupation du pool des canaux
+
 		// === SETTERS ===
 		void setPassword(const std::string &password);						// Définit le mot de passe du canal
 		void setTopic(const std::string &topic);							// Définit le sujet du canal
@@ -61,11 +129,11 @@ class Channel {
 		time_t getTopicTimestamp() const;					// Récupère la date de la dernière modification du sujet
 		time_t getCreationTime() const;						// Récupère le creation time du canal
 		std::string getMode() const; 						// Récupère les modes du canal
-		std::string getNicknames() const;					// Récupère la liste des pseudos des clients connectés au canal
-		std::set<const Client*> getClientsList() const;		// Récupère la liste des clients du canal
-		std::set<const Client*> getOperatorsList() const;	// Récupère la liste des operators du canal
-		std::set<const Client*> getInvitedList() const;		// Récupère la liste des clients invités sur le canal
-		int getChannelClientByNickname(const std::string &nickname, const Client* currClient); // Récupère le client du canal par son pseudo
+		MemberIterator membersBegin(int flag = MEMBER) const;	// Premier client ayant le drapeau (membre par défaut)
+		MemberIterator membersEnd() const;						// Fin du parcours
+		void forEachMember(MemberVisitor& visitor, int flag = MEMBER) const;	// Appelle le visiteur pour chaque client ayant le drapeau
+		int getChannelClientByNickname(const std::string &nickname, const Client* currClient,
+										const NicknameIndex& nicknames) const;	// Récupère le client du canal par son pseudo
 
 		bool getInvites() const;
 		int getNbUser() const;
@@ -91,7 +159,9 @@ class Channel {
 		void removeOperator(Client* client);					// Retire un operator du canal
 		void removeClient(Client* client, const Client* kicker,
 				const std::string& reason, int reasonCode);		// Retire un client du canal
+		void forgetClient(const Client* client);				// Oublie un client qui quitte le serveur (invitation comprise)
 		
 		// === MESSAGES ===
 		void sendToAll(const std::string &message, Client* sender, bool includeSender);	// Envoie un message à tous les clients connectés du canal
+		void sendNames(const Client* client) const;			// Envoie la liste des membres (353 découpées, puis 366)
 };
\ No newline at end of file
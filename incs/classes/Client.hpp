@@ -12,6 +12,7 @@
 #include <map>					// container map
 #include <vector>				// container vector
 #include <set>					// container set
+#include <algorithm>			// std::find()
 
 // === NAMESPACES ===
 #include "../config/irc_config.hpp"
@@ -20,6 +21,12 @@
 #include "Utils.hpp"
 #include "IrcHelper.hpp"
 #include "MessageHandler.hpp"
+#include "SendQueue.hpp"
+#include "InputBuffer.hpp"
+#include "FlushList.hpp"
+#include "Mutex.hpp"
+#include "Logger.hpp"
+#include "ObjectPool.hpp"
 #include "Channel.hpp"
 
 // =========================================================================================
@@ -33,6 +40,7 @@ class Client {
 		Client& operator=(const Client& src);
 
 		int _clientSocketFd;								// Descripteur de socket du client
+		unsigned long _id;									// Numéro de connexion unique (jamais réutilisé, contrairement au fd)
 		bool _authenticated;								// Indique si le client est authentifié
 		bool _rightPassServ;								// Indique si le client a le bon password du serveur
 		
@@ -42,10 +50,11 @@ class Client {
 		bool _isIrssi;										// Indique si le client est un Irssi
 		bool _isIdentified;									// Indique si irssi fournit les nick et user automatiquement
 
-		std::vector<std::string> _identNicknameCmd;			// Commande d'identification nickname d'Irssi
-		std::vector<std::string> _identUsernameCmd;			// Commande d'identification username d'Irssi
+		std::string _identNicknameCmd;						// Ligne d'identification nickname d'Irssi
+		std::string _identUsernameCmd;						// Ligne d'identification username d'Irssi
 
-		std::string _bufferMessage;							// Buffer de message
+		InputBuffer _inputBuffer;							// Buffer des données reçues
+		bool _backlogged;									// Lignes en attente au-delà du budget du tour (file du reactor)
 
 		std::string _nickname;								// Pseudo du client
 		std::string _username;								// Nom d'utilisateur
@@ -56,18 +65,36 @@ class Client {
 		int _port;											// Port client
 		
 		bool _isAway;										// Indique si le client est indiqué absent
+		bool _serverOperator;								// Indique si le client est opérateur du serveur (OPER)
 		std::string _awayMessage;							// Message d'absence
 
 		bool _errorMsgTooLongSent;							// Message d'erreur envoyé si le message est trop long
 		bool _pingSent;										// Indique si le serveur attend un PONG du client
+		bool _leaving;										// Indique si le client est en cours de déconnexion
+
+		mutable Mutex _sendLock;							// Protège la file d'envoi (remplie depuis n'importe quel reactor)
+		mutable SendQueue _sendQueue;						// File des messages en attente d'envoi
+		mutable bool _flushScheduled;						// Indique si le client est déjà dans la liste des envois à faire
+		bool _waitingWritable;								// Indique si le socket est plein (attente de EPOLLOUT)
+		FlushList* _flushList;								// Liste du reactor des clients ayant des messages à envoyer
+		size_t _reactorIndex;								// Reactor propriétaire du socket
 
 		std::map<std::string, Channel*> _channelsJoined;	// Liste des canaux auxquels le client est connecté
+		std::vector<std::string> _invitedChannels;			// Canaux où le client a reçu une invitation (oubliées à sa suppression)
+
+		mutable unsigned long _fanoutMark;					// Dernière diffusion sendToPeers() ayant atteint le client
+		static unsigned long _fanoutGeneration;				// Numéro de la dernière diffusion sendToPeers()
 
 	public:
 		
-		Client(int fd);
+		Client(int fd, unsigned long id);
 		~Client();
 
+		// === MEMORY POOL ===
+		static void* operator new(size_t size);								// Alloue un client dans le pool
+		static void operator delete(void* pointer, size_t size);			// Rend l'emplacement au pool
+		static PoolUsage poolUsage();										// Occupation du pool des clients
+
 		// === SETTERS INFOS CLIENT ===
 		void setNickname(const std::string &nickname);						// Définit le pseudo du client
 		void setUsername(const std::string &username);						// Définit le nom d'utilisateur
@@ -79,8 +106,8 @@ class Client {
 
 		void setIsIrssi(bool status);										// Définit si le client est un Irssi
 		void setIdentified(bool status);									// Définit si irssi fournit les nick et user par indent
-		void setIdentNickCmd(std::vector<std::string> identCmd);			// Définit la commande d'identification nickname d'Irssi
-		void setIdentUsernameCmd(std::vector<std::string> identCmd);		// Définit la commande d'identification username d'Irssi
+		void setIdentNickCmd(const std::string& identCmd);					// Définit la ligne d'identification nickname d'Irssi
+		void setIdentUsernameCmd(const std::string& identCmd);				// Définit la ligne d'identification username d'Irssi
 		void setServPasswordValidity(bool status);							// Définit si le mot de passe est valide
 		void authenticate();												// Authentifie le client
 		
@@ -89,12 +116,25 @@ class Client {
 		void setAwayMessage(const std::string& message); 					// Définit le message d'absence du client
 		void setErrorMsgTooLongSent(bool status);							// Définit si le message d'erreur d'un input trop long est déjà envoyé
 		void setPingSent(bool status);										// Définit si le serveur attend un PONG du client
+		void setLeaving();													// Marque le client comme en cours de déconnexion
+		void setServerOperator(bool status);								// Définit si le client est opérateur du serveur
 		
 		// === BUFFER ===
-		std::string& getBufferMessage();									// Récupère le buffer de message
+		InputBuffer& getInputBuffer();										// Récupère le buffer des données reçues
+		void setBacklogged(bool status);									// Définit si le client attend son tour pour ses lignes restantes
+		bool isBacklogged() const;											// Vérifie si le client attend son tour
+
+		// === SEND QUEUE ===
+		void setReactor(size_t index, FlushList* flushList);				// Définit le reactor propriétaire et sa liste des envois à faire
+		size_t getReactorIndex() const;										// Récupère le reactor propriétaire
+		SendQueue::FlushStatus flushSendQueue();							// Envoie les messages en attente
+		bool sendQueueOverflowed() const;									// Vérifie si le client a dépassé la limite de la file d'envoi
+		void setWaitingWritable(bool status);								// Définit si le socket est plein
+		bool isWaitingWritable() const;										// Vérifie si le socket est plein
 
 		// === GETTERS INFOS CLIENT ===
 		int getFd() const;													// Récupère le descripteur de socket du client
+		unsigned long getId() const;										// Récupère le numéro de connexion unique
 		const std::string& getNickname() const;								// Récupère le pseudo
 		const std::string& getUsername() const;								// Récupère le nom d'utilisateur
 		const std::string& getRealName() const;								// Récupère le nom réel
@@ -105,8 +145,8 @@ class Client {
 
 		bool isIrssi() const;												// Vérifie si le client est un Irssi
 		bool isIdentified() const;											// Vérifie si irssi fournit les nick et user par ident
-		std::vector<std::string> getIdentNickCmd() const;					// Récupère la commande d'identification nickname d'Irssi
-		std::vector<std::string> getIdentUsernameCmd() const;				// Récupère la commande d'identification username d'Irssi
+		const std::string& getIdentNickCmd() const;							// Récupère la ligne d'identification nickname d'Irssi
+		const std::string& getIdentUsernameCmd() const;						// Récupère la ligne d'identification username d'Irssi
 		bool gotValidServPassword() const;									// Vérifie si le client a donné le bon mot de passe du serveur
 		bool isAuthenticated() const;										// Vérifie si le client est authentifié
 		
@@ -117,13 +157,19 @@ class Client {
 		const std::string& getAwayMessage() const;							// Récupère le message d'absence
 		bool errorMsgTooLongSent() const;									// Vérifie si le message d'erreur d'un input trop long est déjà envoyé
 		bool pingSent() const;												// Dit si le serveur attend un PONG du client
+		bool isLeaving() const;												// Vérifie si le client est en cours de déconnexion
+		bool isServerOperator() const;										// Vérifie si le client est opérateur du serveur
 
 		// === SEND MESSAGES ===
 		void sendMessage(const std::string &message, Client* sender) const;						// Le serveur envoie un message au client
+		void queueRawMessage(const SharedBuffer &wireMessage) const;							// Ajoute un message déjà formaté à la file d'envoi
+		static void notifyLineTooLong(const std::string &message, Client* sender);				// Prévient le sender si son message a été tronqué
 		void sendToAll(Channel* channel, const std::string &message, bool includeSender);		// Envoie un message formaté irc à tous les clients connectés a un channel
+		void sendToPeers(const std::string &message, bool includeSelf);						// Envoie un message une seule fois à chaque client partageant un canal
 
 		// === GETTERS CHANNELS ===
 		std::map<std::string, Channel*>& getChannelsJoined();				// Récupère les canaux auxquels le client est connecté
+		const std::vector<std::string>& getInvitedChannels() const;		// Récupère les canaux où le client a été invité
 		bool isInChannel(const std::string& channelName) const;				// Vérifie si le client est membre d'un canal
 		bool isOperator(Channel* channel) const;							// Vérifie si le client est un opérateur sur un canal
 		bool isInvited(const Channel* channel) const;						// Vérifie si le client est invité sur un canal
@@ -12,6 +12,7 @@
 // === CLASSES ===
 #include "Utils.hpp"
 #include "IrcHelper.hpp"
+#include "IrcMessage.hpp"
 #include "Server.hpp"
 
 // =========================================================================================
@@ -24,7 +25,11 @@ class CommandHandler {
 		~CommandHandler();
 
 		// === COMMAND MANAGER : MAIN METHOD ===
-		void manage_command(std::string string_sent);
+		void manage_command(const char* line, size_t length);
+
+		// === DISPATCH TABLE INFOS (STATS) ===
+		static size_t commandCount();						// Nombre de commandes de la table
+		static const char* commandName(size_t command);		// Nom d'une commande de la table
 
 	private :
 		CommandHandler();
@@ -43,12 +48,22 @@ class CommandHandler {
 		std::map<int, Client*>& _clients;
 		std::map<std::string, Channel*>& _channels;
 
-		// === MAP : COMMANDS -> HANDLERS ===
-		std::map<std::string, void (CommandHandler::*)()> fct_map;
-
-		// === CURRENT INPUT TO VECTOR + ITERATOR ===
-		std::vector<std::string> _elements;
-		std::vector<std::string>::iterator _itv;
+		// === DISPATCH TABLE : COMMANDS -> HANDLERS ===
+		typedef void (CommandHandler::*Handler)();
+		struct CommandEntry {
+			const char* name;
+			Handler handler;
+		};
+		static const CommandEntry _commandTable[];			// Table triée par nom, construite à la compilation
+		static const size_t _commandCount;					// Nombre de commandes de la table
+		static size_t _findCommand(const StringView& cmd);	// Recherche dichotomique de la commande, sans tenir compte de la casse (_commandCount si inconnue)
+		void _dispatch(size_t command, const std::string& nickname);	// Exécute la commande
+
+		// === CURRENT INPUT : PARSED LINE ===
+		IrcMessage _message;								// Préfixe, commande et paramètres de la ligne en cours (vues)
+		std::string _param(size_t index) const;				// Copie d'un paramètre (chaîne vide s'il est absent)
+		bool _isEmptyOrInvalid(size_t index) const;			// Vérifie si les paramètres à partir de `index` sont absents ou invalides
+		std::string _identLine;								// Ligne NICK/USER d'identification irssi rejouée (support de _message)
 		
 		// === MODE TOOLS ===
 		char _mode_sign;
@@ -57,12 +72,13 @@ class CommandHandler {
 		// === AUTHENTICATE COMMANDS : CommandHandler_Auth.cpp ===
 		void _authenticateCommand();
 		void _preRegister(const std::string& cmd, int to_do);
+		bool _loadIdentCommand(const std::string& line);
 		void _isRightPassword();
 		void _setNicknameClient();
 		void _setUsernameClient();
-		void _usernameSettings(const std::vector<std::string>::iterator& itArg);
-		void _hostnameSettings(std::vector<std::string>::iterator& itArg);
-		void _realNameSettings(std::vector<std::string>::iterator& itArg, const std::vector<std::string>& args);
+		void _usernameSettings(const std::string& username);
+		void _hostnameSettings(std::string hostname);
+		void _realNameSettings(size_t index);
 		void _handleCapabilities();
 
 		// === CHANNEL COMMANDS : CommandHandler_Channel.cpp ===
@@ -71,6 +87,7 @@ class CommandHandler {
 		void _setTopic();
 		void _kickChannel();
 		void _quitChannel();
+		void _sendNames();
 
 		// === MODE PARSER : CommandHandler_ModeParser.cpp ===
 		void _checkArgAndExecute(std::string &mode, std::string &arg1, std::map<char, std::string> &arg2);
@@ -87,8 +104,8 @@ class CommandHandler {
 
 		// === MESSAGE COMMANDS : CommandHandler_Message.cpp ===
 		void _sendPrivateMessage();
-		void _sendToChannel(std::vector<std::string>& targets, std::string& message);
-		void _sendToClient(std::vector<std::string>& targets, std::string& message);
+		void _sendToChannel(const StringView& targets, const std::string& message);
+		void _sendToClient(const StringView& targets, const std::string& message);
 
 		// === LOG COMMANDS : CommandHandler_Log.cpp ===
 		void _sendPong();
@@ -99,8 +116,14 @@ class CommandHandler {
 		void _setAway();
 		void _quitServer();
 
+		// === OPERATOR COMMANDS : CommandHandler_Oper.cpp ===
+		void _becomeOperator();
+		void _sendStats();
+
 		// === FILE COMMANDS (BONUS) : CommandHandler_File.cpp ===
 		void _handleFile();
-		void _sendFile(std::vector<std::string> entry);
-		void _getFile(std::vector<std::string> entry);
+		void _sendFile();
+		void _getFile();
+		void _resumeFile();
+		void _acceptFile();
 };
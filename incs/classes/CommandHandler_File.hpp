@@ -2,32 +2,19 @@
 
 #include <map>							// container map
 #include <vector>						// container vector
-#include <unistd.h>						// gestion fichiers -> chdir()
 #include <fstream> 						// gestion fichiers -> std::ifstream, std::ofstream
 #include <filesystem> 					// gestion fichiers -> std::filesystem
+#include <sys/stat.h>					// stat() -> taille d'une copie interrompue (RESUME)
+#include <sys/types.h>					// off_t
 
 // === CLASSES ===
 #include "Server.hpp"
+#include "FileTransfer.hpp"
+#include "DccOffers.hpp"
+#include "WorkerPool.hpp"
 
 // =========================================================================================
 
-class File
-{
-	public:
-		std::string Name;
-		std::string Path;
-		std::string sender;
-		std::string receiver;
-
-		File();
-		File( std::string Name, std::string Path, std::string Sender, std::string Receiver );
-		File( const File &x );
-		~File();
-		File & operator = ( const File &rhs );
-
-};
-
-
 class Request
 {
 	public:
@@ -39,4 +26,70 @@ class Request
 		Request( const Request &x );
 		Request & operator = ( const Request &rhs );
 
+};
+
+/**
+ * @brief DCC SEND: checks on a worker thread that the offered file can be read, then registers the offer.
+ */
+class OfferFileJob : public WorkerJob
+{
+	private:
+		File			_file;
+		int				_senderFd;
+		unsigned long	_senderId;
+		int				_receiverFd;
+		unsigned long	_receiverId;
+		bool			_readable;		// Le fichier proposé peut être ouvert
+
+	public:
+		OfferFileJob(const File& file, int senderFd, unsigned long senderId, int receiverFd, unsigned long receiverId);
+		~OfferFileJob();
+
+		void run();
+		void complete(Server& server);
+};
+
+/**
+ * @brief DCC GET: opens the offered file and its copy on a worker thread, then starts the copy.
+ */
+class OpenFileJob : public WorkerJob
+{
+	private:
+		FileTransfer*	_transfer;		// Copie à ouvrir (à nous tant qu'elle n'est pas confiée au reactor)
+		std::string		_sourcePath;
+		std::string		_destPath;
+		off_t			_offset;		// Position acceptée (DCC ACCEPT)
+		bool			_opened;
+
+	public:
+		OpenFileJob(FileTransfer* transfer, const std::string& sourcePath, const std::string& destPath, off_t offset);
+		~OpenFileJob();
+
+		void run();
+		void complete(Server& server);
+};
+
+/**
+ * @brief DCC RESUME: reads the size of the partial copy on a worker thread, then records the resume position.
+ */
+class ResumeFileJob : public WorkerJob
+{
+	private:
+		File			_file;			// Offre concernée (clé dans le registre)
+		unsigned long	_offerId;
+		std::string		_destPath;
+		off_t			_position;		// Position demandée (-1 : taille de la copie interrompue)
+		off_t			_available;		// Taille de la copie interrompue
+		int				_senderFd;
+		unsigned long	_senderId;
+		int				_receiverFd;
+		unsigned long	_receiverId;
+
+	public:
+		ResumeFileJob(const File& file, unsigned long offerId, const std::string& destPath, off_t position,
+			int senderFd, unsigned long senderId, int receiverFd, unsigned long receiverId);
+		~ResumeFileJob();
+
+		void run();
+		void complete(Server& server);
 };
\ No newline at end of file
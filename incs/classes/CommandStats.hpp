@@ -0,0 +1,46 @@
+#pragma once
+
+#include <vector>				// container vector
+#include <cstddef>				// size_t
+
+// === CLASSES ===
+#include "LatencyHistogram.hpp"
+
+// =========================================================================================
+
+/**
+ * @brief Per-command instrumentation of the dispatcher: calls, errors and latency.
+ *
+ * Commands are identified by their index in the dispatch table of CommandHandler, so
+ * recording a command costs no lookup and no allocation. Durations are in microseconds
+ * (monotonic clock). The object is shared by all the reactors: like the rest of the IRC
+ * state, it is only accessed under the server state lock.
+ */
+class CommandStats {
+
+	private:
+		CommandStats();
+		CommandStats(const CommandStats& src);
+		CommandStats& operator=(const CommandStats& src);
+
+		struct Entry {
+			unsigned long calls;								// Nombre d'appels
+			unsigned long errors;								// Appels terminés par une erreur IRC
+			LatencyHistogram latency;							// Durée de traitement (us)
+		};
+		std::vector<Entry> _entries;							// Une entrée par commande de la table
+
+	public:
+		explicit CommandStats(size_t commandCount);
+		~CommandStats();
+
+		static unsigned long now();								// Horloge monotone (microsecondes)
+
+		void record(size_t command, unsigned long elapsed, bool failed);	// Enregistre un appel
+		void reset();											// Remet tous les compteurs à zéro
+
+		size_t size() const;									// Nombre de commandes suivies
+		unsigned long calls(size_t command) const;				// Nombre d'appels d'une commande
+		unsigned long errors(size_t command) const;				// Nombre d'erreurs d'une commande
+		const LatencyHistogram& latency(size_t command) const;	// Histogramme des durées d'une commande
+};
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <string>				// std::string
+#include <vector>				// std::vector
+#include <cstddef>				// size_t
+#include <sys/types.h>			// off_t
+
+// === CLASSES ===
+#include "HashMap.hpp"
+
+// =========================================================================================
+
+/**
+ * @brief A file offered with DCC SEND, waiting for the GET of its receiver.
+ */
+class File
+{
+	public:
+		std::string Name;
+		std::string Path;
+		std::string sender;
+		std::string receiver;
+
+		File();
+		File( std::string Name, std::string Path, std::string Sender, std::string Receiver );
+		File( const File &x );
+		~File();
+		File & operator = ( const File &rhs );
+
+};
+
+/**
+ * @brief A pending offer, as kept by the registry.
+ *
+ * An offer stays registered while its file is copied: if the copy fails, the receiver
+ * can ask to resume it (DCC RESUME), the sender agrees (DCC ACCEPT) and the next GET
+ * starts the copy at the accepted position, from the same entry.
+ */
+struct DccOffer {
+	File file;
+	unsigned long id;										// Numéro de l'offre (timer d'expiration)
+	unsigned long senderId;									// Connexion de l'expéditeur (quota)
+	off_t resumePosition;									// Position demandée par DCC RESUME (-1 si aucune)
+	off_t startOffset;										// Position acceptée par DCC ACCEPT : la copie reprend ici
+	bool copying;											// Copie en cours (GET)
+};
+
+/**
+ * @brief Server-wide registry of the pending DCC offers.
+ *
+ * An offer is identified by (sender, receiver, filename): two users may offer files with
+ * the same name, and a user may offer the same file to several receivers. Nicknames are
+ * compared with the RFC 1459 case mapping (NicknameIndex), the filename as is.
+ * Lookups and removals are O(1) on average and happen in place, in the registry.
+ *
+ * Every offer gets a serial number: the server schedules a timer with it when the offer
+ * is made, and expire() drops the offer when the timer fires, unless it was taken or
+ * replaced in the meantime (the number is never reused, the timer is then ignored).
+ * An offer being copied doesn't expire: it is dropped when its copy is over.
+ * Each sender may only have server::DCC_OFFERS_PER_USER offers pending, which bounds the
+ * memory a user can hold with offers nobody takes. The offers of a connection are indexed
+ * by its number: they are dropped when it is closed (removeSender()), so they can't outlive
+ * the quota they were counted in, nor be taken from the next user of the nickname.
+ */
+class DccOffers {
+
+	private:
+		DccOffers(const DccOffers& src);
+		DccOffers& operator=(const DccOffers& src);
+
+		struct Key {
+			std::string sender;
+			std::string receiver;
+			std::string name;
+
+			Key(const std::string& sender, const std::string& receiver, const std::string& name);
+		};
+		struct KeyHash {
+			size_t operator()(const Key& key) const;
+		};
+		struct KeyEqual {
+			bool operator()(const Key& a, const Key& b) const;
+		};
+		struct IdHash {
+			size_t operator()(unsigned long id) const;
+		};
+		struct IdEqual {
+			bool operator()(unsigned long a, unsigned long b) const;
+		};
+
+		HashMap<Key, DccOffer, KeyHash, KeyEqual> _offers;				// (expéditeur, destinataire, fichier) -> offre
+		HashMap<unsigned long, Key, IdHash, IdEqual> _ids;			// Numéro -> clé de l'offre (expiration)
+		HashMap<unsigned long, std::vector<unsigned long>, IdHash, IdEqual> _perSender;	// Connexion -> numéros de ses offres (quota, départ)
+		unsigned long _nextId;										// Prochain numéro d'offre
+
+		void _erase(const Key& key, const DccOffer& offer);		// Retire une offre et ses index
+		DccOffer* _findById(unsigned long id, Key*& key);			// Offre portant ce numéro, NULL si elle n'est plus là
+
+	public:
+		DccOffers();
+		~DccOffers();
+
+		unsigned long add(const File& file, unsigned long senderId);		// Enregistre une offre (0 si le quota est atteint)
+		DccOffer* find(const std::string& sender, const std::string& receiver,
+							const std::string& name);						// Offre en attente, NULL si aucune
+		bool expire(unsigned long id);										// Retire une offre arrivée à échéance (true si elle est gardée : copie en cours)
+		void copyEnded(unsigned long id, bool done);						// Fin de la copie : offre retirée, ou de nouveau disponible (RESUME)
+		void removeSender(unsigned long senderId);							// Retire les offres d'une connexion fermée
+		size_t size() const;												// Nombre d'offres en attente
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <string>				// std::string
+#include <cstddef>				// size_t
+#include <sys/types.h>			// off_t
+
+// === CLASSES ===
+#include "TokenBucket.hpp"
+#include "WorkerPool.hpp"
+
+// =========================================================================================
+
+/**
+ * @brief One DCC GET copy in progress: the offered file is copied into the receiver directory.
+ *
+ * The copy is driven by the reactor of the receiver, a chunk at a time
+ * (server::DCC_CHUNK_SIZE), each chunk copied by the worker pool (CopyChunkJob):
+ * a large file, or a slow disk, no longer freezes the chat while it is copied.
+ * On Linux the bytes are moved by the kernel with sendfile(), file to file, without any
+ * userspace buffer. The session keeps its offset, so a copy can start (or start again)
+ * in the middle of the file (DCC RESUME).
+ *
+ * The clients are identified by (fd, id) like the timers: they may leave before the end
+ * of the copy, the owner checks they are still there before telling them it is over.
+ *
+ * The server lets a file be written by one copy at a time, and never read while it is
+ * written: the paths are reserved when GET starts (Server::reserveCopy()), the opened
+ * files are compared with the other copies (sharesFile()) before the copy is cut at its
+ * starting position, by its first chunk.
+ *
+ * Each copy has its own byte rate (server::DCC_TRANSFER_RATE), drawn by the reactor from
+ * `bandwidth` before every chunk. The bytes copied so far are published atomically, so
+ * another thread can report the progress and throughput of the copy (STATS d).
+ */
+class FileTransfer {
+
+	private:
+		FileTransfer();
+		FileTransfer(const FileTransfer& src);
+		FileTransfer& operator=(const FileTransfer& src);
+
+		int _sourceFd;											// Fichier proposé (lecture)
+		int _destFd;											// Copie chez le destinataire (écriture)
+		off_t _offset;											// Octets déjà copiés
+		off_t _size;											// Taille du fichier source
+		off_t _startOffset;										// Position de départ (reprise)
+		unsigned long _started;									// Début de la copie (us, horloge monotone)
+		unsigned long _copied;									// Octets copiés depuis le début (accès atomiques)
+		dev_t _sourceDevice;									// Fichier proposé (st_dev, st_ino)
+		ino_t _sourceInode;
+		dev_t _destDevice;										// Copie (st_dev, st_ino)
+		ino_t _destInode;
+		bool _truncated;										// La copie a été coupée à la position de départ
+
+		void _close();											// Ferme les deux fichiers
+
+	public:
+		enum Status {
+			IN_PROGRESS,
+			DONE,
+			FAILED
+		};
+
+		std::string name;										// Nom du fichier
+		std::string sender;										// Pseudo de l'expéditeur
+		std::string receiver;									// Pseudo du destinataire
+		int senderFd;
+		unsigned long senderId;
+		int receiverFd;
+		unsigned long receiverId;
+		unsigned long offerId;									// Offre copiée (retirée ou rendue à la fin)
+		std::string sourcePath;									// Chemins réservés pendant la copie (Server::reserveCopy())
+		std::string destPath;
+		TokenBucket bandwidth;									// Débit de cette copie
+		bool pending;											// Un morceau est en cours de copie dans le pool
+		Status status;											// Résultat du dernier morceau copié
+
+		FileTransfer(const std::string& name, const std::string& sender, int senderFd, unsigned long senderId,
+			const std::string& receiver, int receiverFd, unsigned long receiverId, unsigned long offerId);
+		~FileTransfer();
+
+		bool open(const std::string& sourcePath, const std::string& destPath, off_t offset);	// Ouvre la source et la copie, reprend à `offset`
+		Status advance(size_t chunk);							// Copie au plus `chunk` octets
+		off_t offset() const;									// Octets déjà copiés
+		off_t size() const;										// Taille du fichier source
+		unsigned long copied() const;							// Octets copiés depuis le début (lisible depuis un autre thread)
+		unsigned long throughput(unsigned long now) const;		// Débit moyen depuis le début (octets/s)
+		bool sharesFile(const FileTransfer& other) const;		// Écrit un fichier que l'autre copie lit ou écrit (ou l'inverse)
+};
+
+/**
+ * @brief Copies one chunk of a FileTransfer on a worker thread.
+ *
+ * The reactor doesn't touch the copy until the chunk is over: complete() gives it back,
+ * with the status of the chunk.
+ */
+class CopyChunkJob : public WorkerJob {
+
+	private:
+		CopyChunkJob();
+
+		FileTransfer* _transfer;								// Copie à avancer
+		size_t _chunk;											// Octets accordés pour ce morceau
+		FileTransfer::Status _status;							// Résultat du morceau
+
+	public:
+		CopyChunkJob(FileTransfer* transfer, size_t chunk);
+		~CopyChunkJob();
+
+		void run();
+		void complete(Server& server);
+};
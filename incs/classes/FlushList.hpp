@@ -0,0 +1,40 @@
+#pragma once
+
+#include <vector>				// container vector
+#include <pthread.h>			// pthread_t, pthread_self(), pthread_equal()
+
+// === CLASSES ===
+#include "Mutex.hpp"
+
+// =========================================================================================
+
+/**
+ * @brief Mailbox of the clients that have lines waiting to be sent.
+ *
+ * Every event loop thread owns one list for the clients whose socket it watches.
+ * Any thread may push a client into it (channel fanout, private message...), but only
+ * the owner takes the fds back and writes to the sockets.
+ * When a push comes from another thread and the list was empty, one byte is written
+ * to the owner's wakeup pipe so that it leaves its poller wait and flushes at once.
+ */
+class FlushList {
+
+	private:
+		FlushList(const FlushList& src);
+		FlushList& operator=(const FlushList& src);
+
+		Mutex _lock;										// Protège _fds
+		std::vector<int> _fds;								// Clients à envoyer (un même fd peut apparaître deux fois)
+		int _wakeFd;										// Extrémité écriture du pipe de réveil du propriétaire (-1 si aucun)
+		pthread_t _owner;									// Thread propriétaire
+		bool _hasOwner;										// Le propriétaire est défini
+
+	public:
+		FlushList();
+		~FlushList();
+
+		void setOwner(int wakeFd);							// Le thread appelant devient le propriétaire
+		void push(int fd);									// Ajoute un client (depuis n'importe quel thread)
+		bool take(std::vector<int>& fds);					// Récupère la liste courante (false si vide)
+		bool ownedByCaller();								// Le thread appelant est le propriétaire
+};
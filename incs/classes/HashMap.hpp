@@ -0,0 +1,126 @@
+#pragma once
+
+#include <vector>				// container vector
+#include <cstddef>				// size_t
+
+// =========================================================================================
+
+/**
+ * @brief Minimal chained hash table (C++98 has no unordered_map).
+ *
+ * `Hash` and `Equal` are functors taking two keys, so a table can hash and compare keys
+ * in its own way (e.g. case insensitive nicknames) without storing normalized copies.
+ * The number of buckets is always a power of two and doubles when the load factor
+ * reaches 1: find/insert/erase are O(1) on average.
+ *
+ * Pointers returned by find() stay valid until the key is erased (nodes never move).
+ */
+template <typename K, typename V, typename Hash, typename Equal>
+class HashMap {
+
+	private:
+		struct Node {
+			K key;
+			V value;
+			Node* next;
+			Node(const K& k, const V& v, Node* n) : key(k), value(v), next(n) {}
+		};
+
+		HashMap(const HashMap& src);
+		HashMap& operator=(const HashMap& src);
+
+		std::vector<Node*> _buckets;						// Listes chaînées, une par bucket
+		size_t _size;										// Nombre de clés
+		Hash _hash;
+		Equal _equal;
+
+		size_t _bucketOf(const K& key) const {
+			return _hash(key) & (_buckets.size() - 1);
+		}
+
+		// Double le nombre de buckets et redistribue les noeuds (sans réallocation des noeuds)
+		void _grow() {
+			std::vector<Node*> old(_buckets.size() * 2, static_cast<Node*>(NULL));
+			old.swap(_buckets);
+			for (size_t i = 0; i < old.size(); ++i) {
+				Node* node = old[i];
+				while (node) {
+					Node* next = node->next;
+					size_t b = _bucketOf(node->key);
+					node->next = _buckets[b];
+					_buckets[b] = node;
+					node = next;
+				}
+			}
+		}
+
+	public:
+		explicit HashMap(size_t buckets = 64) : _buckets(1, static_cast<Node*>(NULL)), _size(0) {
+			size_t n = 1;
+			while (n < buckets)
+				n *= 2;
+			_buckets.assign(n, static_cast<Node*>(NULL));
+		}
+		~HashMap() {
+			clear();
+		}
+
+		// Renvoie la valeur associée à la clé, NULL si absente
+		V* find(const K& key) {
+			for (Node* node = _buckets[_bucketOf(key)]; node; node = node->next)
+				if (_equal(node->key, key))
+					return &node->value;
+			return NULL;
+		}
+		const V* find(const K& key) const {
+			return const_cast<HashMap*>(this)->find(key);
+		}
+
+		// Ajoute la clé, false si elle existe déjà (la valeur n'est pas modifiée)
+		bool insert(const K& key, const V& value) {
+			if (find(key))
+				return false;
+			if (_size >= _buckets.size())
+				_grow();
+			size_t b = _bucketOf(key);
+			_buckets[b] = new Node(key, value, _buckets[b]);
+			_size++;
+			return true;
+		}
+
+		// Supprime la clé, false si elle n'existait pas
+		bool erase(const K& key) {
+			Node** link = &_buckets[_bucketOf(key)];
+			while (*link) {
+				if (_equal((*link)->key, key)) {
+					Node* node = *link;
+					*link = node->next;
+					delete node;
+					_size--;
+					return true;
+				}
+				link = &(*link)->next;
+			}
+			return false;
+		}
+
+		void clear() {
+			for (size_t i = 0; i < _buckets.size(); ++i) {
+				Node* node = _buckets[i];
+				while (node) {
+					Node* next = node->next;
+					delete node;
+					node = next;
+				}
+				_buckets[i] = NULL;
+			}
+			_size = 0;
+		}
+
+		size_t size() const {
+			return _size;
+		}
+		bool empty() const {
+			return _size == 0;
+		}
+};
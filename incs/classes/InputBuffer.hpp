@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>				// size_t
+
+// === NAMESPACES ===
+#include "../config/irc_config.hpp"
+
+// =========================================================================================
+
+/**
+ * @brief Contiguous input buffer of a client socket, with in-place line framing.
+ *
+ * recv() writes straight at the end of the buffer, complete lines are then handed out
+ * as (pointer, length) views on the received bytes: no copy, no allocation per line.
+ * Only the unterminated tail (partial line) is ever moved back to the front, and only
+ * when the free space at the end runs out. The part already scanned for '\n' is
+ * remembered, so a long pipelined batch is scanned once: O(n) instead of O(n²).
+ *
+ * The read size adapts to the traffic: it doubles when a read fills the whole window
+ * and shrinks when reads stay small.
+ */
+class InputBuffer {
+
+	private:
+		InputBuffer(const InputBuffer& src);
+		InputBuffer& operator=(const InputBuffer& src);
+
+		char* _data;										// Zone mémoire (allouée à la première lecture)
+		size_t _capacity;									// Taille de la zone mémoire
+		size_t _start;										// Début de la ligne en cours
+		size_t _scan;										// Position jusqu'où on a déjà cherché le '\n'
+		size_t _end;										// Fin des données reçues
+		size_t _readSize;									// Taille de la prochaine lecture (adaptative)
+
+		void _reserve(size_t needed);						// Garantit `needed` octets libres en fin de buffer
+
+	public:
+		InputBuffer();
+		~InputBuffer();
+
+		char* prepareWrite(size_t& available);				// Zone où recv() doit écrire + sa taille
+		void commitWrite(size_t written);					// Valide les octets écrits par recv()
+		bool peekLine(const char*& line, size_t& length);	// Montre la prochaine ligne complète sans la consommer
+		bool nextLine(const char*& line, size_t& length);	// Extrait la prochaine ligne complète (sans \r\n)
+		size_t pending() const;								// Taille de la ligne partielle en attente
+		void clear();										// Oublie les données en attente
+};
@@ -17,6 +17,7 @@
 
 // === CLASSES ===
 #include "Utils.hpp"
+#include "IrcMessage.hpp"
 #include "MessageHandler.hpp"
 #include "Client.hpp"
 #include "Channel.hpp"
@@ -47,7 +48,7 @@ class IrcHelper {
 		static std::string formatUsername(const std::string& username);
 
 		// === MESSAGES HELPER ===
-		static std::string sanitizeIrcMessage(std::string msg, const std::string& cmd, const std::string& nickname);
+		static std::string sanitizeIrcMessage(const IrcMessage& message, size_t index, const std::string& cmd, const std::string& nickname);
 
 		// === CHANNEL HELPER ===
 		static int isRightChannel(const Client& client, const std::string& channelName, std::map<std::string, Channel*>& channels, const std::string& opt);
@@ -59,6 +60,6 @@ class IrcHelper {
 		static int isRightMode(const std::string &mode);
 		static int findCharFromPosition(const std::string& str, char target1, char target2, size_t start_pos);
 		static size_t howManyArgsIsWaiting(std::string mode);
-		static std::map<char, std::string> whichModeForWhichArg(std::vector<std::string> args);
+		static std::map<char, std::string> whichModeForWhichArg(const IrcMessage& message);
 		static void checkDuplicate(std::string &str, char c, size_t i);
 };
\ No newline at end of file
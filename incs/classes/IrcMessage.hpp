@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>				// size_t
+
+// === NAMESPACES ===
+#include "../config/irc_config.hpp"
+
+// === CLASSES ===
+#include "StringView.hpp"
+
+// =========================================================================================
+
+/**
+ * @brief One IRC line split in place (RFC 1459 / 2812 message grammar).
+ *
+ *   [":" prefix SPACE] command *( SPACE middle ) [SPACE ":" trailing]
+ *
+ * parse() walks the line once and only records views into it: no copy and no heap
+ * allocation, whatever the number of parameters. At most server::MESSAGE_MAX_PARAMS
+ * parameters are kept; as in RFC 2812, the last one takes the rest of the line even
+ * without ':'. Runs of spaces between parameters are accepted.
+ *
+ * The views point into the parsed buffer: the message is only valid while that buffer
+ * is. Copying an IrcMessage copies the views, not the characters.
+ */
+class IrcMessage {
+
+	public:
+		IrcMessage();
+		~IrcMessage();
+
+		bool parse(const char* line, size_t length);		// Découpe une ligne (false si elle n'a pas de commande)
+
+		const StringView& line() const;						// Ligne complète
+		const StringView& prefix() const;					// Préfixe sans ':' (vide s'il est absent)
+		const StringView& command() const;					// Commande, telle qu'envoyée
+		size_t paramCount() const;							// Nombre de paramètres
+		StringView param(size_t index) const;				// Paramètre `index` (vue vide s'il est absent)
+		StringView paramsFrom(size_t index) const;			// Fin de la ligne à partir du paramètre `index`
+		bool isTrailing(size_t index) const;				// Vérifie si le paramètre est le dernier, introduit par ':'
+
+	private:
+		StringView _line;
+		StringView _prefix;
+		StringView _command;
+		StringView _params[server::MESSAGE_MAX_PARAMS];
+		size_t _paramCount;
+		bool _trailing;										// Le dernier paramètre est introduit par ':'
+};
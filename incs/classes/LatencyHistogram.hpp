@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>				// size_t
+
+// =========================================================================================
+
+/**
+ * @brief Fixed-bucket log-scale histogram of durations (microseconds).
+ *
+ * Values below 16 have their own bucket, above that every power of two is split into
+ * 16 linear sub-buckets: the relative error of a percentile is at most 1/16 (~6%)
+ * whatever the magnitude, for a fixed memory footprint and an O(1) record().
+ * No allocation: histograms can be recorded on the hot path and summed with merge().
+ */
+class LatencyHistogram {
+
+	public:
+		static const unsigned int SUB_BUCKET_BITS = 4;							// 16 sous-buckets par puissance de 2
+		static const unsigned int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+		static const unsigned int BUCKETS = 64 * SUB_BUCKETS;					// Couvre toute la plage d'un unsigned long 64 bits
+
+	private:
+		unsigned long _counts[BUCKETS];											// Nombre de valeurs par bucket
+		unsigned long _total;													// Nombre total de valeurs
+		unsigned long _max;														// Plus grande valeur enregistrée
+		unsigned long _sum;														// Somme des valeurs (moyenne)
+
+		static unsigned int _bucketOf(unsigned long value);						// Bucket d'une valeur
+		static unsigned long _bucketHighest(unsigned int bucket);				// Plus grande valeur d'un bucket
+
+	public:
+		LatencyHistogram();
+		LatencyHistogram(const LatencyHistogram& src);
+		LatencyHistogram& operator=(const LatencyHistogram& src);
+		~LatencyHistogram();
+
+		void record(unsigned long value);										// Enregistre une durée
+		void merge(const LatencyHistogram& other);								// Ajoute les valeurs d'un autre histogramme
+		void reset();															// Oublie toutes les valeurs
+
+		unsigned long count() const;											// Nombre de valeurs
+		unsigned long max() const;												// Plus grande valeur
+		unsigned long mean() const;												// Moyenne
+		unsigned long percentile(double percent) const;							// Valeur sous laquelle se trouvent `percent`% des valeurs
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>				// std::string
+#include <cstddef>				// size_t
+#include <pthread.h>			// pthread_t
+
+// === NAMESPACES ===
+#include "../config/irc_config.hpp"
+
+// =========================================================================================
+
+/**
+ * @brief Asynchronous server log.
+ *
+ * The event loops never write to the terminal themselves: a record is copied into a
+ * fixed size lock-free ring buffer (multi-producer, single consumer) and a background
+ * thread writes the records in batches. If stdout is a slow pipe, only the log thread
+ * waits. When the ring is full the record is dropped and counted, the log thread then
+ * reports how many records were lost.
+ *
+ * Records below the minimum level (IRCSERV_LOG_LEVEL) are discarded before any copy.
+ * Before start() and after stop() (e.g. startup errors), records are written synchronously.
+ */
+class Logger {
+
+	private:
+		Logger();
+		Logger(const Logger& src);
+		Logger& operator=(const Logger& src);
+		~Logger();
+
+		/**
+		 * @brief A slot of the ring. `sequence` tells who may use it:
+		 * == position -> free for the producer of this position,
+		 * == position + 1 -> filled, ready for the log thread.
+		 */
+		struct Record {
+			size_t sequence;
+			int level;
+			size_t length;
+			char data[server::LOG_RECORD_MAX];
+		};
+
+		static Record* _ring;								// Buffer circulaire des enregistrements
+		static size_t _mask;								// Taille du buffer - 1
+		static size_t _enqueuePos;							// Prochaine position à remplir (producteurs, CAS atomique)
+		static size_t _dequeuePos;							// Prochaine position à écrire (thread de log uniquement)
+		static unsigned long _dropped;						// Enregistrements perdus (buffer plein)
+		static int _running;								// Le thread de log tourne (accès atomiques)
+		static int _stopping;								// Arrêt demandé au thread de log
+		static int _minLevel;								// Niveau minimal enregistré
+		static pthread_t _thread;							// Thread de log
+
+		static bool _push(int level, const std::string& message);			// Copie un enregistrement dans le buffer
+		static bool _pop(std::string& out, std::string& err);				// Récupère le plus ancien enregistrement
+		static void _writeAll(int fd, const std::string& data);				// Ecrit tout le bloc (thread de log)
+		static void* _drain(void* arg);										// Boucle du thread de log
+
+	public:
+		static void start(log_level::Level minLevel);						// Lance le thread de log
+		static void stop();													// Ecrit les enregistrements restants et arrête le thread
+		static log_level::Level levelFromEnv();								// Niveau minimal demandé (IRCSERV_LOG_LEVEL)
+
+		static bool enabled(log_level::Level level);						// Vérifie si un niveau est enregistré
+		static void log(log_level::Level level, const std::string& message);	// Enregistre un message
+		static void verbose(const std::string& message);
+		static void info(const std::string& message);
+		static void warning(const std::string& message);
+		static void error(const std::string& message);
+		static unsigned long dropped();										// Nombre d'enregistrements perdus
+};
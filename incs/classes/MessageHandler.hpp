@@ -1,9 +1,11 @@
 #pragma once
 
 #include <iostream>			// gestion chaînes de caractères -> std::cout, std::cerr, std::string
-#include <sstream>			// gestion flux -> std::ostringstream
+#include <sstream>			// gestion flux -> std::ostringstream (messages serveur)
 #include <ctime> 			// gestion temps -> std::time_t, std::tm
 #include <vector>			// container vector
+#include <cstring>			// strerror()
+#include <sys/types.h>		// off_t (positions DCC RESUME / ACCEPT)
 
 // === NAMESPACES ===
 #include "../config/irc_config.hpp"
@@ -13,6 +15,7 @@
 
 // === CLASSES ===
 #include "Utils.hpp"
+#include "ReplyBuilder.hpp"
 
 // =========================================================================================
 
@@ -75,6 +78,7 @@ class MessageHandler {
 
 		// === RPL CHANNELS ===
 		static std::string ircNameReply(const std::string& nickname, const std::string& channelName, const std::string& users);
+		static std::string ircEndOfNames(const std::string& nickname, const std::string& channelName);
 		static std::string ircNoTopic(const std::string& nickname, const std::string& channelName);
 		static std::string ircTopic(const std::string& nickname, const std::string& channelName, const std::string& topic);
 		static std::string ircTopicWhoTime(const std::string& nickname, const std::string& setterNick, const std::string& channelName, time_t topicTime);
@@ -124,6 +128,17 @@ class MessageHandler {
 		static std::string ircNeedMoreParams(const std::string& nickname, const std::string& command);
 		static std::string ircNotRegistered(void);
 
+		// === OPERATOR ===
+		static std::string ircYoureOper(const std::string& nickname);
+		static std::string ircNoPrivileges(const std::string& nickname);
+		static std::string ircNoOperHost(const std::string& nickname);
+		static std::string ircStatsCommand(const std::string& nickname, const std::string& command, unsigned long calls, unsigned long errors,
+												unsigned long p50, unsigned long p99, unsigned long max);
+		static std::string ircStatsPool(const std::string& nickname, const std::string& pool, size_t inUse, size_t peak, size_t capacity, size_t slabs);
+		static std::string ircStatsTransfer(const std::string& nickname, const std::string& filename, const std::string& sender, const std::string& receiver,
+												unsigned long copied, off_t size, unsigned long throughput);
+		static std::string ircEndOfStats(const std::string& nickname, const std::string& query);
+
 		// === MODE ===
 		static std::string ircChannelModeIs(const std::string& nickname, const std::string& channel, const std::string& displaymode);
 		static std::string ircCreationTime(const std::string& nickname, const std::string& channel, time_t time);
@@ -146,10 +161,14 @@ class MessageHandler {
 
 		// === SETTINGS ===
 		static std::string msgSignalCaught(const std::string& signalType);
+		static std::string msgReactorsStarted(size_t count, const std::string& backend, bool reusePort);
+		static std::string msgLogRecordsDropped(unsigned long count);
+		static std::string msgSystemError(const std::string& context, int errorNumber);
 		
 		// === CLIENTS ===
 		static std::string msgClientConnected(const std::string& clientIp, int port, int socket, const std::string& nickname);
 		static std::string msgClientDisconnected(const std::string& clientIp, int port, int socket, const std::string& nickname);
+		static std::string msgClientIsOperator(const std::string& nickname, const std::string& operName);
 
 		// === CHANNELS ===
 		static std::string msgClientCreatedChannel(const std::string& nickname, const std::string& channelName, const std::string& password);
@@ -167,6 +186,10 @@ class MessageHandler {
 		/**************************** BONUS ****************************/
 		
 		static std::string msgSendFile(const std::string& filename, const std::string &client, const std::string &adr, const int &port);
-		static std::string errorMsgSendFile(const std::string& filename);
+		static std::string errorMsgSendFile(const std::string& path);
 		static std::string MsgSendingFile(const std::string& filename, const std::string& receiver, const std::string& ip, const int &port);
+		static std::string msgResumeFile(const std::string& filename, const std::string& receiver, off_t position);
+		static std::string msgAcceptFile(const std::string& filename, const std::string& sender, off_t position);
+		static std::string msgTransferStats(unsigned long copied, unsigned long throughput);
+		static std::string msgTransferEnded(const std::string& filename, const std::string& sender, const std::string& receiver, bool done, const std::string& stats);
 };
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <pthread.h>			// pthread_mutex_t, pthread_mutex_lock()...
+
+// =========================================================================================
+
+/**
+ * @brief Thin wrapper around a pthread mutex (C++98 has no std::mutex).
+ */
+class Mutex {
+
+	private:
+		Mutex(const Mutex& src);
+		Mutex& operator=(const Mutex& src);
+
+		pthread_mutex_t _mutex;
+
+		friend class Condition;
+
+	public:
+		Mutex();
+		~Mutex();
+
+		void lock();											// Verrouille (bloquant)
+		void unlock();											// Déverrouille
+};
+
+/**
+ * @brief Locks a mutex for the lifetime of the object (RAII).
+ *
+ * The mutex is released on every exit path, exceptions included, so command handlers
+ * can keep throwing while the server state is locked.
+ */
+class MutexLock {
+
+	private:
+		MutexLock();
+		MutexLock(const MutexLock& src);
+		MutexLock& operator=(const MutexLock& src);
+
+		Mutex& _mutex;
+
+	public:
+		explicit MutexLock(Mutex& mutex);
+		~MutexLock();
+};
+
+/**
+ * @brief Thin wrapper around a pthread condition variable, waited on with a locked Mutex.
+ */
+class Condition {
+
+	private:
+		Condition(const Condition& src);
+		Condition& operator=(const Condition& src);
+
+		pthread_cond_t _cond;
+
+	public:
+		Condition();
+		~Condition();
+
+		void wait(Mutex& mutex);								// Libère le mutex (verrouillé) le temps de l'attente
+		void signal();											// Réveille un thread en attente
+		void broadcast();										// Réveille tous les threads en attente
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>				// std::string
+
+// === CLASSES ===
+#include "HashMap.hpp"
+
+// =========================================================================================
+
+class Client;
+
+/**
+ * @brief Server-wide index: nickname -> Client, O(1) on average.
+ *
+ * Nicknames are compared with the RFC 1459 case mapping: A-Z and []\~ are the upper
+ * case versions of a-z and {}|^, so "Nick[1]" and "nick{1}" are the same nickname.
+ * Hashing and comparison fold the case on the fly: a lookup doesn't allocate.
+ * The index is updated by the server on NICK changes and when a client is deleted.
+ */
+class NicknameIndex {
+
+	private:
+		NicknameIndex(const NicknameIndex& src);
+		NicknameIndex& operator=(const NicknameIndex& src);
+
+		struct Hash {
+			size_t operator()(const std::string& nickname) const;
+		};
+		struct Equal {
+			bool operator()(const std::string& a, const std::string& b) const;
+		};
+
+		HashMap<std::string, Client*, Hash, Equal> _clients;	// Pseudo (tel que choisi) -> client
+
+	public:
+		NicknameIndex();
+		~NicknameIndex();
+
+		static char casefold(char c);											// Minuscule RFC 1459 d'un caractère
+		static bool equals(const std::string& a, const std::string& b);		// Compare deux pseudos sans tenir compte de la casse
+
+		Client* find(const std::string& nickname) const;						// Client portant ce pseudo, NULL si aucun
+		bool add(const std::string& nickname, Client* client);					// Enregistre un pseudo (false s'il est déjà pris)
+		void remove(const std::string& nickname, const Client* client);		// Retire le pseudo s'il appartient bien au client
+		size_t size() const;													// Nombre de pseudos enregistrés
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <vector>				// container vector
+#include <new>					// operator new / delete
+#include <cstddef>				// size_t
+
+// === CLASSES ===
+#include "Mutex.hpp"
+
+// =========================================================================================
+
+/**
+ * @brief Occupancy counters of an ObjectPool (STATS p).
+ */
+struct PoolUsage {
+	const char* name;										// Type des objets du pool
+	size_t inUse;											// Objets vivants
+	size_t peak;											// Maximum d'objets vivants atteint
+	size_t capacity;										// Emplacements alloués (libres + utilisés)
+	size_t slabs;											// Nombre de blocs alloués
+};
+
+/**
+ * @brief Type-specific slab allocator with a free list.
+ *
+ * Memory is taken from the heap in slabs of `SlotsPerSlab` objects and never given back
+ * before the pool is destroyed: an object freed by a disconnection is reused by the next
+ * connection, so a reconnect storm costs no malloc and does not fragment the heap.
+ * allocate() and release() are O(1) (pop/push on the free list).
+ *
+ * A class uses it through its own operator new/delete, call sites keep plain new/delete.
+ * Requests that do not have the size of T (derived class) go to the global heap.
+ * The pool has its own lock: objects may be created and destroyed from any reactor.
+ */
+template <typename T, size_t SlotsPerSlab>
+class ObjectPool {
+
+	private:
+		ObjectPool(const ObjectPool& src);
+		ObjectPool& operator=(const ObjectPool& src);
+
+		// Un emplacement libre contient le lien vers le suivant, un emplacement utilisé contient l'objet
+		union Slot {
+			Slot* next;
+			char storage[sizeof(T)];
+			long double alignLongDouble;					// Alignement maximal de l'objet
+			void* alignPointer;
+		};
+
+		const char* _name;									// Type des objets (monitoring)
+		std::vector<Slot*> _slabs;							// Blocs alloués
+		Slot* _free;										// Liste des emplacements libres
+		size_t _inUse;										// Objets vivants
+		size_t _peak;										// Maximum d'objets vivants atteint
+		Mutex _lock;
+
+		// Ajoute un bloc et chaîne ses emplacements dans la liste libre
+		void _grow() {
+			Slot* slab = static_cast<Slot*>(::operator new(sizeof(Slot) * SlotsPerSlab));
+			_slabs.push_back(slab);
+			for (size_t i = 0; i < SlotsPerSlab; ++i) {
+				slab[i].next = _free;
+				_free = &slab[i];
+			}
+		}
+
+	public:
+		explicit ObjectPool(const char* name) : _name(name), _free(NULL), _inUse(0), _peak(0) {}
+		~ObjectPool() {
+			for (size_t i = 0; i < _slabs.size(); ++i)
+				::operator delete(_slabs[i]);
+		}
+
+		void* allocate(size_t size) {
+			if (size != sizeof(T))
+				return ::operator new(size);
+
+			MutexLock lock(_lock);
+			if (_free == NULL)
+				_grow();
+			Slot* slot = _free;
+			_free = slot->next;
+			if (++_inUse > _peak)
+				_peak = _inUse;
+			return slot;
+		}
+
+		void release(void* pointer, size_t size) {
+			if (pointer == NULL)
+				return;
+			if (size != sizeof(T)) {
+				::operator delete(pointer);
+				return;
+			}
+
+			MutexLock lock(_lock);
+			Slot* slot = static_cast<Slot*>(pointer);
+			slot->next = _free;
+			_free = slot;
+			--_inUse;
+		}
+
+		PoolUsage usage() {
+			MutexLock lock(_lock);
+			PoolUsage res;
+			res.name = _name;
+			res.inUse = _inUse;
+			res.peak = _peak;
+			res.capacity = _slabs.size() * SlotsPerSlab;
+			res.slabs = _slabs.size();
+			return res;
+		}
+};
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <vector>				// container vector
+#include <set>					// container set
+#include <sys/select.h>			// select() -> fd_set, FD_SET, FD_ISSET...
+
+#ifdef __linux__
+# include <sys/epoll.h>			// epoll_create(), epoll_ctl(), epoll_wait()
+#endif
+
+// === NAMESPACES ===
+#include "../config/irc_config.hpp"
+
+// =========================================================================================
+
+/**
+ * @brief A ready descriptor returned by Poller::wait().
+ *
+ * `events` is a combination of poll_event::Flags (READ, WRITE, ERROR).
+ */
+struct PollEvent {
+	int fd;
+	int events;
+};
+
+/**
+ * @brief Abstract event loop backend.
+ *
+ * The server only talks to this interface: descriptors are registered once with
+ * the events they are interested in, and wait() fills a vector with the descriptors
+ * that are actually ready, so the cost of a wakeup is O(ready) and not O(maxFd).
+ *
+ * Backends are edge-triggered when the platform allows it: the caller must always
+ * drain a ready descriptor (accept/recv until EAGAIN).
+ */
+class Poller {
+
+	private:
+		Poller(const Poller& src);
+		Poller& operator=(const Poller& src);
+
+	protected:
+		Poller();
+
+	public:
+		virtual ~Poller();
+
+		static Poller* create();											// Instancie le meilleur backend disponible
+
+		virtual bool add(int fd, int events) = 0;							// Surveille un nouveau descripteur
+		virtual bool modify(int fd, int events) = 0;						// Change les événements surveillés d'un descripteur
+		virtual void remove(int fd) = 0;									// Arrête de surveiller un descripteur
+		virtual int wait(std::vector<PollEvent>& ready, int timeoutMs) = 0;	// Attend des événements (-1 si erreur)
+		virtual const char* name() const = 0;								// Nom du backend (logs)
+};
+
+#ifdef __linux__
+/**
+ * @brief epoll(7) backend, edge-triggered, no limit on the number of descriptors.
+ */
+class EpollPoller : public Poller {
+
+	private:
+		EpollPoller(const EpollPoller& src);
+		EpollPoller& operator=(const EpollPoller& src);
+
+		int _epollFd;											// Descripteur de l'instance epoll
+		std::vector<struct epoll_event> _events;				// Buffer rempli par epoll_wait()
+
+		static unsigned int _toEpoll(int events);				// poll_event::Flags -> EPOLLIN/EPOLLOUT
+		static int _fromEpoll(unsigned int events);				// EPOLLIN/EPOLLOUT -> poll_event::Flags
+
+	public:
+		EpollPoller();
+		~EpollPoller();
+
+		bool add(int fd, int events);
+		bool modify(int fd, int events);
+		void remove(int fd);
+		int wait(std::vector<PollEvent>& ready, int timeoutMs);
+		const char* name() const;
+};
+#endif
+
+/**
+ * @brief select(2) fallback backend, level-triggered, limited to FD_SETSIZE descriptors.
+ */
+class SelectPoller : public Poller {
+
+	private:
+		SelectPoller(const SelectPoller& src);
+		SelectPoller& operator=(const SelectPoller& src);
+
+		fd_set _readFds;										// Ensemble des descripteurs surveillés en lecture
+		fd_set _writeFds;										// Ensemble des descripteurs surveillés en écriture
+		std::set<int> _fds;										// Descripteurs enregistrés (triés pour _getMaxFd())
+
+		int _getMaxFd() const;									// Récupère le descripteur maximum pour select()
+
+	public:
+		SelectPoller();
+		~SelectPoller();
+
+		bool add(int fd, int events);
+		bool modify(int fd, int events);
+		void remove(int fd);
+		int wait(std::vector<PollEvent>& ready, int timeoutMs);
+		const char* name() const;
+};
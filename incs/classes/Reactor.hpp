@@ -0,0 +1,72 @@
+#pragma once
+
+#include <map>					// container map
+#include <vector>				// container vector
+#include <pthread.h>			// pthread_t
+
+// === CLASSES ===
+#include "Poller.hpp"
+#include "TimerQueue.hpp"
+#include "FlushList.hpp"
+#include "FileTransfer.hpp"
+#include "WorkerPool.hpp"
+
+// =========================================================================================
+
+class Client;
+class Server;
+
+/**
+ * @brief State of one event loop thread (multi-reactor mode).
+ *
+ * The server runs one reactor per thread. A reactor owns a subset of the client
+ * sockets: those it accepted on its listening socket. Only its thread reads from,
+ * writes to, watches, times out and deletes these clients, so everything here except
+ * `flushList` and `completions` is touched by a single thread and needs no lock
+ * (`transfers` is also read by STATS d: it only changes under the server state lock).
+ * The IRC state (clients, channels, nicknames) stays shared and is protected by the
+ * server state lock.
+ */
+struct Reactor {
+
+	size_t index;														// Numéro du reactor (0 = thread principal)
+	Server* server;														// Serveur propriétaire (point d'entrée du thread)
+	pthread_t thread;													// Thread (reactors > 0)
+	bool threadStarted;													// Le thread a été lancé
+
+	Poller* poller;														// Backend de la boucle d'événements (epoll / select)
+	std::vector<PollEvent> readyEvents;									// Descripteurs prêts remontés par le poller
+	int listenFd;														// Socket d'écoute surveillé par ce reactor
+	bool ownsListener;													// Le socket d'écoute est propre à ce reactor (SO_REUSEPORT)
+	int wakePipe[2];													// Pipe de réveil (nouveaux envois, travaux terminés, arrêt)
+
+	FlushList flushList;												// Clients ayant des messages en attente d'envoi
+	std::vector<int> flushing;											// Clients en cours d'envoi (tampon réutilisé)
+	std::vector<int> backlog;											// Clients au budget épuisé, servis au tour suivant
+	std::vector<int> backlogRound;										// Clients servis pendant ce tour (tampon réutilisé)
+	TimerQueue timers;													// Echéances PING / PONG des clients
+	TimerQueue offerTimers;												// Expiration des offres DCC faites depuis ce reactor (id = numéro d'offre)
+	std::map<int, Client*> clients;										// Clients de ce reactor (accès sans verrou)
+	std::vector<std::map<int, Client*>::iterator> clientsToDelete;		// Clients à supprimer (sous le verrou du serveur)
+	std::vector<FileTransfer*> transfers;								// Copies de fichiers DCC en cours (un morceau par tour)
+	size_t transferCursor;												// Première copie servie au prochain tour (tourniquet)
+	unsigned long transferDelay;										// Attente (us) avant qu'une copie ait du débit (0 = prête)
+	CompletionQueue completions;										// Travaux du pool terminés, à reprendre par ce reactor
+
+	Reactor(size_t index, Server* server);
+	~Reactor();
+
+	void drainWakePipe();												// Vide le pipe de réveil
+	void wake();														// Réveille le thread du reactor
+	void requestStop();													// Demande l'arrêt de la boucle (depuis un autre thread)
+	bool stopRequested();												// Vérifie si l'arrêt a été demandé
+
+	private:
+		int _stop;														// Arrêt demandé (accès atomiques)
+
+		Reactor();
+		Reactor(const Reactor& src);
+		Reactor& operator=(const Reactor& src);
+
+		void _release();												// Ferme les descripteurs et libère le poller
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>				// std::string
+#include <vector>				// container vector
+#include <cstddef>				// size_t
+
+// =========================================================================================
+
+/**
+ * @brief Pre-rendered welcome burst (001-004 and MOTD) sent to every registering client.
+ *
+ * The lines only depend on the server, except for the nickname (every line) and the
+ * usermask (001). They are formatted once, when the server starts, with placeholders
+ * where these fields go, then cut at the placeholders: welcoming a client is a copy
+ * of the static pieces with its nickname and usermask patched in, already formatted
+ * for the wire (one buffer for the whole burst).
+ */
+class RegistrationBurst {
+
+	private:
+		RegistrationBurst(const RegistrationBurst& src);
+		RegistrationBurst& operator=(const RegistrationBurst& src);
+
+		enum Field {
+			NONE,												// Fin du burst
+			NICKNAME,
+			USERMASK
+		};
+
+		std::vector<std::string> _pieces;						// Texte fixe entre deux champs
+		std::vector<Field> _fields;								// Champ qui suit chaque morceau
+		size_t _staticSize;										// Taille cumulée des morceaux
+
+	public:
+		RegistrationBurst();
+		~RegistrationBurst();
+
+		void build(const std::string& serverCreationTime);		// Formate les lignes une fois pour toutes
+		void render(const std::string& nickname, const std::string& usermask, std::string& out) const;	// Ajoute le burst d'un client à `out`
+};
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <string>				// std::string
+#include <cstring>				// strlen()
+#include <cstddef>				// size_t
+
+// === NAMESPACES ===
+#include "../config/irc_config.hpp"
+
+// =========================================================================================
+
+/**
+ * @brief Three-digit text of a numeric reply ("001", "353"...), built at compile time.
+ *
+ * One instance per code used: the digits are constant data, nothing is converted
+ * when a reply is formatted.
+ */
+template <unsigned int Code>
+struct NumericCode {
+	typedef char codeHasThreeDigits[Code < 1000 ? 1 : -1];	// Erreur de compilation si le code est invalide
+	static const char text[4];
+};
+
+template <unsigned int Code>
+const char NumericCode<Code>::text[4] = {
+	static_cast<char>('0' + Code / 100),
+	static_cast<char>('0' + Code / 10 % 10),
+	static_cast<char>('0' + Code % 10),
+	'\0'
+};
+
+/**
+ * @brief Appends the pieces of a reply to a string, without streams.
+ *
+ * Replaces std::ostringstream in MessageHandler: no locale, no stream buffer, no copy
+ * of the result. The builder writes straight into the string it is given (usually the
+ * return value of the reply function), after reserving room for a whole IRC line,
+ * so a reply costs one allocation. Integers are converted by hand.
+ *
+ *   std::string line;
+ *   ReplyBuilder reply(line);
+ *   reply.numeric<RPL_TOPIC>(nickname) << " " << channelName << " :" << topic;
+ */
+class ReplyBuilder {
+
+	private:
+		ReplyBuilder(const ReplyBuilder& src);
+		ReplyBuilder& operator=(const ReplyBuilder& src);
+
+		std::string& _out;
+
+		// Écrit les chiffres de `value` à partir de la fin de `end` : retourne le premier chiffre
+		static char* _digits(unsigned long value, char* end) {
+			do {
+				*--end = static_cast<char>('0' + value % 10);
+				value /= 10;
+			} while (value);
+			return end;
+		}
+		ReplyBuilder& _unsigned(unsigned long value) {
+			char buffer[24];
+			char* first = _digits(value, buffer + sizeof(buffer));
+			_out.append(first, buffer + sizeof(buffer) - first);
+			return *this;
+		}
+		ReplyBuilder& _signed(long value) {
+			if (value >= 0)
+				return _unsigned(static_cast<unsigned long>(value));
+			_out += '-';
+			return _unsigned(0UL - static_cast<unsigned long>(value));
+		}
+
+	public:
+		explicit ReplyBuilder(std::string& out) : _out(out) {
+			_out.reserve(_out.size() + server::BUFFER_SIZE);
+		}
+
+		// ":<server> <code> <target>"
+		template <unsigned int Code>
+		ReplyBuilder& numeric(const std::string& target) {
+			numeric<Code>();
+			_out += ' ';
+			_out += target;
+			return *this;
+		}
+		// ":<server> <code>" (réponse sans destinataire)
+		template <unsigned int Code>
+		ReplyBuilder& numeric() {
+			_out += ':';
+			_out += server::NAME;
+			_out += ' ';
+			_out.append(NumericCode<Code>::text, 3);
+			return *this;
+		}
+
+		ReplyBuilder& operator<<(const std::string& str) {
+			_out += str;
+			return *this;
+		}
+		ReplyBuilder& operator<<(const char* str) {
+			_out.append(str, std::strlen(str));
+			return *this;
+		}
+		ReplyBuilder& operator<<(char c) {
+			_out += c;
+			return *this;
+		}
+		ReplyBuilder& operator<<(int value) {
+			return _signed(value);
+		}
+		ReplyBuilder& operator<<(long value) {
+			return _signed(value);
+		}
+		ReplyBuilder& operator<<(unsigned int value) {
+			return _unsigned(value);
+		}
+		ReplyBuilder& operator<<(unsigned long value) {
+			return _unsigned(value);
+		}
+};
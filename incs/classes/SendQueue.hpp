@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>				// std::string
+#include <deque>				// container deque
+#include <cstddef>				// size_t
+
+// === NAMESPACES ===
+#include "../config/irc_config.hpp"
+
+// === CLASSES ===
+#include "SharedBuffer.hpp"
+
+// =========================================================================================
+
+/**
+ * @brief Bounded outbound queue of a client socket.
+ *
+ * Lines are appended as they are produced and written later, many at once, with a
+ * single scatter/gather call. Chunks are SharedBuffer: a broadcast line sits once in
+ * memory, whatever the number of queues it was pushed to. Whatever the kernel does not
+ * accept stays queued (partial writes included) until the socket becomes writable again.
+ * Once more than `limit` bytes are pending, the queue is marked as overflowed and drops
+ * everything: the server then disconnects the client (slow consumer).
+ */
+class SendQueue {
+
+	private:
+		SendQueue(const SendQueue& src);
+		SendQueue& operator=(const SendQueue& src);
+
+		std::deque<SharedBuffer> _chunks;					// Lignes en attente d'envoi (partagées)
+		size_t _offset;										// Octets déjà envoyés du premier chunk
+		size_t _size;										// Nombre total d'octets en attente
+		size_t _limit;										// Taille max de la file (sendq)
+		bool _overflowed;									// La limite a été dépassée
+		bool _blocked;										// Le dernier envoi s'est arrêté sur EAGAIN
+
+	public:
+		enum FlushStatus {
+			FLUSH_DONE,										// File vide
+			FLUSH_PENDING,									// Socket plein (EAGAIN), il reste des données
+			FLUSH_ERROR										// Erreur d'écriture, connexion à fermer
+		};
+
+		explicit SendQueue(size_t limit);
+		~SendQueue();
+
+		bool push(const SharedBuffer& data);				// Ajoute des données (false si la limite est dépassée)
+		FlushStatus flush(int fd);							// Ecrit un maximum de données sur le socket
+		void clear();										// Vide la file
+
+		bool empty() const;									// Vérifie si la file est vide
+		size_t size() const;								// Nombre d'octets en attente
+		bool overflowed() const;							// Vérifie si la limite a été dépassée
+		bool blocked() const;								// Vérifie si le socket était plein au dernier envoi
+};
@@ -12,6 +12,17 @@
 #include "MessageHandler.hpp"
 #include "Utils.hpp"
 #include "IrcHelper.hpp"
+#include "Poller.hpp"
+#include "NicknameIndex.hpp"
+#include "TimerQueue.hpp"
+#include "Mutex.hpp"
+#include "Logger.hpp"
+#include "CommandStats.hpp"
+#include "RegistrationBurst.hpp"
+#include "DccOffers.hpp"
+#include "TokenBucket.hpp"
+#include "WorkerPool.hpp"
+#include "Reactor.hpp"
 #include "Client.hpp"
 #include "Channel.hpp"
 #include "CommandHandler.hpp"
@@ -31,41 +42,79 @@ class Server {
 		std::string _password;													// Mot de passe du serveur
 		std::string _localIp;													// Adresse IP locale
 		std::string _timeCreationStr;											// Date et heure de création du serveur
+		std::string _operPassword;												// Mot de passe OPER (vide = OPER désactivé)
+		RegistrationBurst _registrationBurst;									// Lignes 001-004 et MOTD pré-formatées
 
-		// === SOCKETS ===
-		int _serverSocketFd;													// Descripteur du socket du serveur
-		int _maxFd;																// Descripteur maximum pour select()
-		fd_set _readFds;														// Ensemble des descripteurs surveillés
+		// === EVENT LOOPS ===
+		std::vector<Reactor*> _reactors;										// Boucles d'événements (une par thread, 0 = thread principal)
+		bool _reusePort;														// Chaque reactor a son propre socket d'écoute (SO_REUSEPORT)
+		WorkerPool _workers;													// Threads des travaux bloquants (fichiers DCC)
+		static int _signalPipe[2];												// Self-pipe : réveille le poller à la réception d'un signal
+
+		// === SHARED STATE ===
+		Mutex _stateLock;														// Protège l'état IRC partagé entre les reactors
+		unsigned long _nextClientId;											// Prochain numéro de connexion
+		CommandStats _commandStats;												// Appels, erreurs et latences par commande
+		size_t _registeredCount;												// Clients enregistrés (tenu à jour, LUSERS)
 		
 		// === CONTAINERS -> CLIENTS + CHANNELS ===
 		std::map<int, Client*> _clients;										// Liste des clients connectés
-		std::vector<std::map<int, Client*>::iterator> _clientsToDelete;			// Liste des clients à supprimer (stocke les iterateurs map des clients)
 		std::map<std::string, Channel*> _channels;								// Liste des canaux
+		NicknameIndex _nicknames;												// Index pseudo -> client (RFC 1459)
 
 		// === BONUS ===
-		std::map<std::string, File>	_files;
+		DccOffers _offers;														// Offres DCC SEND en attente de GET
+		Mutex _bandwidthLock;													// Protège _bandwidth (copies de tous les reactors)
+		TokenBucket _bandwidth;													// Débit de toutes les copies DCC du serveur
+		std::set<std::string> _copyDestinations;								// Copies DCC en cours : fichiers écrits (un seul écrivain)
+		std::map<std::string, size_t> _copySources;								// Copies DCC en cours : fichiers lus (nombre de copies)
 
 		// === INIT / CLEAN ===
 		void _setSignal();														// Paramétrage du signal
 		void _setLocalIp();														// Récupère l'adresse IP locale
-		void _setServerSocket();												// Paramétrage du socket serveur
-		int _getMaxFd();														// Récupère le descripteur maximum pour select()
+		int _createListener(bool reusePort);									// Crée un socket d'écoute
+		void _setReactors();													// Crée les boucles d'événements et leurs sockets d'écoute
+		void _setWakeupPipe();													// Paramétrage du self-pipe des signaux
+		void _drainWakeupPipe();												// Vide le self-pipe des signaux
+		static size_t _reactorCount();											// Nombre de boucles d'événements demandé
 		
 		void _init();															// Initialise le serveur
-		void _checkActivity();													// Vérifie l'activité des clients
+		int _pollTimeout(const Reactor& reactor) const;							// Délai d'attente du poller jusqu'au prochain timer
+		void _runTimers(Reactor& reactor);										// Vérifie l'activité des clients dont l'échéance est atteinte
 		void _start();															// Démarre le serveur
+		static void* _reactorThread(void* arg);									// Point d'entrée des threads des reactors
+		void _runReactor(Reactor& reactor);										// Boucle d'événements d'un reactor
+		bool _stopRequested(Reactor& reactor) const;							// Vérifie si la boucle d'un reactor doit s'arrêter
+		void _stopReactors();													// Arrête et attend les threads des reactors
 		void _clean();															// Nettoie le serveur avant fermeture
 		
 		// === MESSAGES / COMMANDS ===
-		void _handleMessage(std::map<int, Client*>::iterator it);				// Gère la lecture des messages d'un client
+		void _handleMessage(Reactor& reactor, Client* client);					// Gère la lecture des messages d'un client
+		bool _processLines(Client* client, size_t& budget, size_t& priority);		// Traite les lignes complètes d'un client dans la limite de son budget
+		static bool _isPriorityLine(const char* line, size_t length);			// Vérifie si la ligne est un PING / PONG (voie prioritaire)
+		void _backlogClient(Reactor& reactor, Client* client);					// Met un client au budget épuisé dans le backlog du reactor
+		void _serveBacklog(Reactor& reactor);									// Donne leur tour aux clients du backlog
 		void _processInput(std::map<int, Client*>::iterator it, 
-											std::string message);				// Traite l'entrée du client
+											const char* line, size_t length);	// Traite l'entrée du client
+		void _flushClient(Reactor& reactor, Client* client);					// Envoie les messages en attente d'un client
+		void _flushPendingClients(Reactor& reactor);							// Envoie les messages en attente de tous les clients concernés
 		
 		// === UPDATE CLIENTS ===
-		void _acceptNewClient();												// Accepte une nouvelle connexion client
+		void _acceptNewClients(Reactor& reactor);								// Accepte toutes les connexions clients en attente
+		void _acceptNewClient(Reactor& reactor, int newClientFd);				// Enregistre une nouvelle connexion client
+		void _dropClient(int fd, const std::string& reason);					// Fait partir un client depuis son reactor (prend le verrou)
 		void _disconnectClient(int fd, const std::string& reason); 				// Déconnecte un client du serveur
 		void _deleteClient(std::map<int, Client*>::iterator it);				// Supprime un client de la liste
-		void _lateClientDeletion();												// Supprime les clients de la liste en différé
+		void _lateClientDeletion(Reactor& reactor);								// Supprime les clients de la liste en différé
+		void _greetClient(Client* client);										// Envoie le burst de bienvenue à un client enregistré
+
+		// === WORKER POOL ===
+		void _runCompletions(Reactor& reactor);									// Suite des travaux terminés par le pool
+
+		// === FILE TRANSFERS (BONUS) ===
+		bool _runTransfers(Reactor& reactor, bool interactive);					// Avance d'un morceau les copies DCC du reactor qui ont du débit
+		size_t _grantTransfer(FileTransfer& transfer, unsigned long now, unsigned long& wait);	// Octets que la copie peut copier maintenant
+		void _endTransfer(FileTransfer* transfer, FileTransfer::Status status, unsigned long now);	// Fin d'une copie : offre, messages, log
 	
 	public:
 		
@@ -80,20 +129,35 @@ class Server {
 
 		// === SERVER INFOS ===
 		const std::string& getServerPassword() const;
+		bool hasOperPassword() const;
+		bool isOperPassword(const std::string& password) const;
+		CommandStats& getCommandStats();
 
 		// === CLIENTS ===
 		std::map<int, Client*>& getClients();
 		int getTotalClientCount() const;
 		int getClientCount(bool authenticated);
 		int getClientByNickname(const std::string& nickname, Client* currClient);
-		void greetClient(Client* client);
+		Client* getConnectedClient(int fd, unsigned long id);
+		bool setClientNickname(Client* client, const std::string& nickname);
+		const NicknameIndex& getNicknameIndex() const;
+		void registerClient(Client* client);
 		void prepareClientToLeave(std::map<int, Client*>::iterator it, const std::string& reason);
 
 		// === CHANNELS ===
 		std::map<std::string, Channel*>& getChannels();
 		int getChannelCount() const;
-		void broadcastToClients(const std::string &message);
+
+		// === WORKER POOL ===
+		void submitJob(Client* client, WorkerJob* job);
 
 		// === BONUS ===
-		std::map<std::string, File>& getFiles();
+		DccOffers& getOffers();
+		bool addOffer(Client* sender, const File& file);
+		void startTransfer(Client* receiver, FileTransfer* transfer);
+		std::vector<const FileTransfer*> getTransfers() const;
+		bool reserveCopy(const std::string& source, const std::string& dest);
+		void releaseCopy(const std::string& source, const std::string& dest);
+		bool isCopyPath(const std::string& path) const;
+		bool copyConflicts(const FileTransfer* transfer) const;
 };
\ No newline at end of file
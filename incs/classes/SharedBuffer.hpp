@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>				// std::string
+#include <cstddef>				// size_t
+
+// =========================================================================================
+
+/**
+ * @brief Immutable, reference-counted wire buffer.
+ *
+ * A line sent to many clients (channel message, QUIT, NICK...) is formatted once into
+ * a SharedBuffer, then the same bytes are queued to every recipient: copying a
+ * SharedBuffer only increments a counter, the bytes are freed with the last copy.
+ * The counter is updated atomically, so copies can be released from any thread.
+ */
+class SharedBuffer {
+
+	private:
+		struct Block {
+			int refs;										// Nombre de SharedBuffer partageant le bloc
+			std::string data;								// Octets à envoyer (déjà formatés IRC)
+		};
+
+		Block* _block;										// NULL si buffer vide
+
+		void _release();									// Décrémente le compteur et libère le bloc si besoin
+
+	public:
+		SharedBuffer();
+		explicit SharedBuffer(const std::string& data);
+		SharedBuffer(const SharedBuffer& src);
+		SharedBuffer& operator=(const SharedBuffer& src);
+		~SharedBuffer();
+
+		static SharedBuffer adopt(std::string& data);		// Prend les octets de `data` sans les copier (data est vidée)
+
+		const char* data() const;							// Pointeur sur les octets
+		size_t size() const;								// Nombre d'octets
+		bool empty() const;									// Vérifie si le buffer est vide
+		int useCount() const;								// Nombre de copies partageant les octets
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <string>				// std::string
+#include <cstring>				// strlen(), memcmp()
+#include <cctype>				// toupper()
+#include <cstddef>				// size_t
+
+// =========================================================================================
+
+/**
+ * @brief Non-owning view of a slice of a character buffer (C++98 has no string_view).
+ *
+ * A view is two words: copying it copies no character. It stays valid as long as the
+ * buffer it points into is neither freed nor modified (for a parsed line, until the end
+ * of the command).
+ */
+struct StringView {
+	const char* data;
+	size_t size;
+
+	StringView() : data(""), size(0) {}
+	StringView(const char* str, size_t length) : data(str), size(length) {}
+	StringView(const std::string& str) : data(str.data()), size(str.size()) {}
+
+	bool empty() const {
+		return size == 0;
+	}
+	char operator[](size_t i) const {
+		return data[i];
+	}
+	std::string str() const {
+		return std::string(data, size);
+	}
+
+	bool operator==(const char* other) const {
+		return std::strlen(other) == size && std::memcmp(data, other, size) == 0;
+	}
+	bool operator!=(const char* other) const {
+		return !(*this == other);
+	}
+
+	// Compare à un nom en majuscules sans tenir compte de la casse (noms de commandes) : <0, 0 ou >0
+	int compareUpper(const char* upper) const {
+		size_t i = 0;
+		for (; i < size && upper[i]; ++i) {
+			int c = std::toupper(static_cast<unsigned char>(data[i]));
+			if (c != static_cast<unsigned char>(upper[i]))
+				return c < static_cast<unsigned char>(upper[i]) ? -1 : 1;
+		}
+		if (i < size)
+			return 1;
+		return upper[i] ? -1 : 0;
+	}
+
+	/**
+	 * @brief Walks a separated list ("#a,#b,,#c"): returns the item starting at `pos`
+	 * and moves `pos` after its separator. Empty items are kept, an empty view has one
+	 * empty item.
+	 *
+	 * @return bool false once every item has been returned.
+	 */
+	bool split(char separator, size_t& pos, StringView& item) const {
+		if (pos > size)
+			return false;
+		size_t end = pos;
+		while (end < size && data[end] != separator)
+			++end;
+		item = StringView(data + pos, end - pos);
+		pos = end + 1;
+		return true;
+	}
+};
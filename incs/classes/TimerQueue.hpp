@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>				// container vector
+#include <ctime> 				// std::time_t
+
+// =========================================================================================
+
+/**
+ * @brief A timer: `deadline` (UNIX time) for the object identified by (fd, id).
+ *
+ * The fd alone is not enough to identify a client: once a socket is closed, the kernel
+ * reuses its number for the next connection. `id` is a serial number that is never
+ * reused, so the timer of a deleted client can't fire on its successor.
+ */
+struct Timer {
+	time_t deadline;
+	int fd;
+	unsigned long id;
+};
+
+/**
+ * @brief Min-heap of timers, ordered by deadline.
+ *
+ * schedule() and popExpired() are O(log n), nextDeadline() is O(1), so the event loop
+ * can sleep exactly until the next deadline and only touch the timers that expired.
+ * Timers are never cancelled: the owner checks, when a timer fires, whether it is still
+ * relevant and schedules a new one if needed (lazy rescheduling).
+ */
+class TimerQueue {
+
+	private:
+		TimerQueue(const TimerQueue& src);
+		TimerQueue& operator=(const TimerQueue& src);
+
+		std::vector<Timer> _heap;							// Tas binaire (le plus proche en premier)
+
+	public:
+		TimerQueue();
+		~TimerQueue();
+
+		void schedule(time_t deadline, int fd, unsigned long id);	// Programme un timer
+		bool popExpired(time_t now, Timer& timer);				// Retire le prochain timer échu (false si aucun)
+		bool empty() const;										// Vérifie s'il reste des timers
+		time_t nextDeadline() const;							// Echéance la plus proche (file non vide)
+		size_t size() const;									// Nombre de timers programmés
+		void clear();											// Supprime tous les timers
+};
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>				// size_t
+
+// =========================================================================================
+
+/**
+ * @brief Byte-rate limiter: `rate` tokens (bytes) per second, at most `burst` in stock.
+ *
+ * The tokens are refilled lazily, from the time elapsed since the last call: a bucket
+ * costs nothing while nobody draws from it. The caller takes what available() gives,
+ * and when it's too little, delay() tells how long to wait for more instead of polling.
+ * A rate of 0 means no limit. Not thread-safe: a shared bucket is locked by its owner.
+ */
+class TokenBucket {
+
+	private:
+		TokenBucket();
+
+		double _rate;											// Octets par seconde (0 = illimité)
+		double _burst;											// Réserve max (octets)
+		double _tokens;											// Octets disponibles
+		unsigned long _last;									// Dernier remplissage (us, horloge monotone)
+
+	public:
+		TokenBucket(size_t rate, size_t burst);
+		~TokenBucket();
+
+		size_t available(unsigned long now);					// Remplit la réserve et renvoie les octets disponibles
+		void consume(size_t bytes);								// Retire des octets de la réserve
+		unsigned long delay(size_t bytes) const;				// Attente (us) avant d'avoir `bytes` octets
+		bool limited() const;									// Le débit est limité
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <deque>				// container deque
+#include <vector>				// container vector
+#include <cstddef>				// size_t
+#include <pthread.h>			// pthread_t
+
+// === CLASSES ===
+#include "Mutex.hpp"
+
+// =========================================================================================
+
+class Server;
+class CompletionQueue;
+
+/**
+ * @brief A blocking operation handed to the worker pool, and what to do once it is done.
+ *
+ * run() is called on a worker thread: it may block (disk, resolver) but must not touch
+ * the server state. complete() is then called on the thread of the reactor that submitted
+ * the job, with the server state lock held, like a command: the clients the job is about
+ * may have left in the meantime, it checks they are still there. The job is deleted
+ * right after (or without being run nor completed, when the server stops).
+ */
+class WorkerJob {
+
+	private:
+		WorkerJob(const WorkerJob& src);
+		WorkerJob& operator=(const WorkerJob& src);
+
+		WorkerJob* _next;										// Suivant dans la file de fin (CompletionQueue)
+		CompletionQueue* _completions;							// File du reactor qui attend la fin
+
+		friend class CompletionQueue;
+		friend class WorkerPool;
+
+	public:
+		WorkerJob();
+		virtual ~WorkerJob();
+
+		virtual void run() = 0;									// Travail bloquant (thread du pool, sans l'état du serveur)
+		virtual void complete(Server& server) = 0;				// Suite du travail (thread du reactor, sous le verrou d'état)
+};
+
+/**
+ * @brief Lock-free queue of the finished jobs of a reactor (many workers, one reactor).
+ *
+ * The workers push with a compare-and-swap on the head of an intrusive list, and wake
+ * the reactor up (wake pipe) only when the list was empty: its poller reports the end
+ * of a job like any other event. The reactor takes the whole list at once.
+ */
+class CompletionQueue {
+
+	private:
+		CompletionQueue(const CompletionQueue& src);
+		CompletionQueue& operator=(const CompletionQueue& src);
+
+		WorkerJob* _head;										// Dernier travail terminé (accès atomiques)
+		int _wakeFd;											// Écriture du pipe de réveil du reactor
+
+	public:
+		CompletionQueue();
+		~CompletionQueue();
+
+		void setWakeFd(int wakeFd);								// Pipe de réveil du reactor propriétaire
+		void push(WorkerJob* job);								// Ajoute un travail terminé (n'importe quel thread)
+		WorkerJob* take();										// Prend tous les travaux terminés, dans l'ordre (reactor)
+		static WorkerJob* next(const WorkerJob* job);			// Travail suivant dans la liste prise
+};
+
+/**
+ * @brief Fixed-size pool of threads running the blocking jobs off the reactors.
+ *
+ * Jobs are taken in submission order. If no thread could be started, submit() runs
+ * the job right away, on the calling thread: slower, but nothing is lost.
+ */
+class WorkerPool {
+
+	private:
+		WorkerPool(const WorkerPool& src);
+		WorkerPool& operator=(const WorkerPool& src);
+
+		std::vector<pthread_t> _threads;						// Threads du pool
+		std::deque<WorkerJob*> _jobs;							// Travaux en attente d'un thread
+		Mutex _lock;											// Protège _jobs et _stopping
+		Condition _ready;										// Signalée à chaque nouveau travail (et à l'arrêt)
+		bool _stopping;											// Arrêt demandé
+
+		static void* _work(void* arg);							// Boucle d'un thread du pool
+
+	public:
+		WorkerPool();
+		~WorkerPool();
+
+		void start(size_t count);								// Démarre les threads
+		void stop();											// Termine les travaux en cours et arrête les threads
+		void submit(WorkerJob* job, CompletionQueue& completions);	// Confie un travail, sa fin revient dans `completions`
+};
@@ -15,6 +15,7 @@ namespace commands
 	const std::string KICK					= "KICK";
 	const std::string PART 					= "PART";
 	const std::string MODE					= "MODE";
+	const std::string NAMES					= "NAMES";
 	const std::string PRIVMSG 				= "PRIVMSG";
 	const std::string PING 					= "PING";
 	const std::string PONG 					= "PONG";
@@ -24,4 +25,6 @@ namespace commands
 	const std::string AWAY 					= "AWAY";
 	const std::string QUIT		 			= "QUIT";
 	const std::string DCC					= "DCC";
+	const std::string OPER					= "OPER";
+	const std::string STATS					= "STATS";
 }
\ No newline at end of file
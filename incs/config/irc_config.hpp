@@ -11,9 +11,81 @@ namespace server
 	const std::string UNKNOWN_IP 			= "unknown IP";
 
 	const size_t BUFFER_SIZE 				= 510;
+	const size_t INPUT_READ_MIN 			= 4096;		// Taille de lecture initiale d'un client
+	const size_t INPUT_READ_MAX 			= 65536;	// Taille de lecture max d'un client
+	const size_t INPUT_LINE_MAX 			= 8192;		// Taille max d'une ligne partielle avant d'être jetée
+	const size_t MESSAGE_MAX_PARAMS 		= 15;		// Nombre max de paramètres d'une commande (RFC 2812)
 
 	const int PING_INTERVAL 				= 240;
 	const int PONG_TIMEOUT 					= 300;
+
+	const int POLL_MAX_EVENTS 				= 1024;		// Nombre max d'événements remontés par réveil
+	const size_t COMMANDS_PER_WAKEUP 		= 64;		// Commandes traitées par client et par tour de boucle
+	const size_t PRIORITY_PER_WAKEUP 		= 4;		// PING / PONG non comptés dans ce budget, par client et par tour
+
+	const std::string REACTORS_ENV 			= "IRCSERV_REACTORS";	// Variable d'environnement : nombre de threads de boucle d'événements
+	const size_t REACTORS_MAX 				= 64;		// Nombre max de threads de boucle d'événements
+
+	const std::string OPER_PASSWORD_ENV 	= "IRCSERV_OPER_PASSWORD";	// Variable d'environnement : mot de passe OPER (OPER désactivé si absente)
+
+	const std::string LOG_LEVEL_ENV 		= "IRCSERV_LOG_LEVEL";	// Variable d'environnement : niveau de log minimal (verbose, info, warning, error)
+	const size_t LOG_RING_SIZE 				= 2048;		// Nombre d'enregistrements en attente d'écriture (puissance de 2)
+	const size_t LOG_RECORD_MAX 			= 512;		// Taille max d'un enregistrement (tronqué au-delà)
+	const unsigned int LOG_IDLE_MIN_US 		= 1000;		// Attente du thread de log quand le buffer est vide (min)
+	const unsigned int LOG_IDLE_MAX_US 		= 50000;	// Attente du thread de log quand le buffer est vide (max)
+
+	const size_t CLIENT_POOL_SLAB 			= 64;		// Clients alloués d'un coup par le pool (slab)
+	const size_t CHANNEL_POOL_SLAB 			= 32;		// Canaux alloués d'un coup par le pool (slab)
+
+	const size_t SENDQ_MAX 					= 512 * 1024;	// Octets max en attente d'envoi par client avant déconnexion
+	const size_t SENDQ_IOV_MAX 				= 64;		// Nombre max de lignes envoyées par appel système
+	const size_t SENDQ_FLUSH_THRESHOLD 		= 16 * 1024;	// Octets en attente à partir desquels on écrit sans attendre
+
+	const size_t DCC_CHUNK_SIZE 			= 256 * 1024;	// Octets copiés par transfert DCC et par tour de boucle
+	const size_t DCC_MIN_CHUNK 				= 16 * 1024;	// Octets min par appel de copie (en dessous, on attend d'avoir le débit)
+	const size_t DCC_TRANSFER_RATE 			= 16 * 1024 * 1024;	// Débit max d'une copie DCC (octets/s, 0 = illimité)
+	const size_t DCC_TOTAL_RATE 			= 64 * 1024 * 1024;	// Débit max de toutes les copies DCC du serveur (octets/s, 0 = illimité)
+	const int DCC_OFFER_TTL 				= 600;		// Durée de validité d'une offre DCC SEND sans GET (secondes)
+	const size_t DCC_OFFERS_PER_USER 		= 16;		// Offres DCC en attente max par client
+
+	const size_t WORKER_THREADS 			= 4;		// Threads du pool de travaux bloquants (fichiers DCC)
+}
+
+// === LOAD GENERATOR (ircbench) ===
+namespace bench
+{
+	const size_t DEFAULT_CLIENTS 			= 1000;		// Nombre de connexions par défaut
+	const size_t DEFAULT_CHANNELS 			= 10;		// Nombre de canaux par défaut (join, fanout)
+	const double DEFAULT_RATE 				= 1.0;		// Messages par seconde et par client par défaut
+	const int DEFAULT_DURATION 				= 10;		// Durée de la charge par défaut (secondes)
+	const size_t CONNECT_BATCH 				= 200;		// Connexions ouvertes par tour de boucle
+	const int SETUP_TIMEOUT 				= 30;		// Attente max de l'enregistrement / des JOIN (secondes)
+	const int DRAIN_TIMEOUT 				= 3;		// Attente des derniers messages après la charge (secondes)
+	const size_t SENDQ_MAX 					= 64 * 1024 * 1024;	// File d'envoi d'un client simulé (jamais atteinte)
+	const std::string MESSAGE_TAG 			= "bench";	// Préfixe des messages horodatés
+}
+
+// === POLLER EVENTS ===
+namespace poll_event
+{
+	enum Flags
+	{
+		READ  								= 1,
+		WRITE  								= 2,
+		ERROR  								= 4
+	};
+}
+
+// === LOG LEVELS ===
+namespace log_level
+{
+	enum Level
+	{
+		VERBOSE  							= 0,
+		INFO  								= 1,
+		WARNING  							= 2,
+		ERROR  								= 3
+	};
 }
 
 // === SPLITTER MODE ===
@@ -17,7 +17,10 @@ namespace server_messages
 	const std::string ERR_SET_SOCKET 				= "Failed to set socket";
 	const std::string ERR_SET_SERVER_NON_BLOCKING 	= "Failed to set server socket to non-blocking";
 	const std::string ERR_SET_CLIENT_NON_BLOCKING 	= "Failed to set client socket to non-blocking";
-	const std::string ERR_SELECT_SOCKET 			= "Failed to select socket";
+	const std::string ERR_POLL_SOCKET 				= "Failed to poll sockets";
+	const std::string ERR_POLLER_ADD 				= "Failed to watch server socket";
+	const std::string ERR_WAKEUP_PIPE 				= "Failed to create wakeup pipe";
+	const std::string ERR_THREAD_CREATION 			= "Failed to start event loop thread";
 	const std::string ERR_BIND_SOCKET 				= "Failed to bind server socket. Address already in use";
 	const std::string ERR_LISTEN_SOCKET 			= "Failed to listen on server socket";
 	const std::string ERR_ACCEPT_CLIENT 			= "Failed to accept client";
@@ -52,6 +55,7 @@ namespace server_messages
 	const std::string SHUTDOWN_REASON 				= "Server shutting down";
 	const std::string CONNECTION_FAILED 			= "Connection failed";
 	const std::string CONNECTION_TIMEOUT 			= "Connection timeout";
+	const std::string SENDQ_EXCEEDED 				= "Max SendQ exceeded";
 
 
 	// === BONUS BOT (AGE COMMAND) ===
@@ -4,85 +4,173 @@
 using namespace commands;
 
 // =========================================================================================
+/**
+ * @brief Process-wide dispatch table: command name -> handler.
+ *
+ * The table is a constant array, built by the compiler and never copied: a CommandHandler
+ * is now a lightweight per-line context whose construction costs no allocation.
+ * Entries MUST stay sorted by name (strcmp order), _findCommand() does a binary search.
+ * Names match the constants of the commands namespace.
+ */
+const CommandHandler::CommandEntry CommandHandler::_commandTable[] = {
+	{ "AWAY", 		&CommandHandler::_setAway },				// CommandHandler_Log.cpp
+	{ "CAP", 		&CommandHandler::_handleCapabilities },		// CommandHandler_Auth.cpp
+	{ "DCC", 		&CommandHandler::_handleFile },				// CommandHandler_File.cpp (BONUS)
+	{ "INVITE", 	&CommandHandler::_inviteChannel },			// CommandHandler_Channel.cpp
+	{ "JOIN", 		&CommandHandler::_joinChannel },			// CommandHandler_Channel.cpp
+	{ "KICK", 		&CommandHandler::_kickChannel },			// CommandHandler_Channel.cpp
+	{ "MODE", 		&CommandHandler::_changeMode },				// CommandHandler_ModeParser.cpp
+	{ "NAMES", 		&CommandHandler::_sendNames },				// CommandHandler_Channel.cpp
+	{ "NICK", 		&CommandHandler::_setNicknameClient },		// CommandHandler_Auth.cpp
+	{ "OPER", 		&CommandHandler::_becomeOperator },			// CommandHandler_Oper.cpp
+	{ "PART", 		&CommandHandler::_quitChannel },			// CommandHandler_Channel.cpp
+	{ "PASS", 		&CommandHandler::_isRightPassword },		// CommandHandler_Auth.cpp
+	{ "PING", 		&CommandHandler::_sendPong },				// CommandHandler_Log.cpp
+	{ "PONG", 		&CommandHandler::_updateActivity },			// CommandHandler_Log.cpp
+	{ "PRIVMSG", 	&CommandHandler::_sendPrivateMessage },		// CommandHandler_Message.cpp
+	{ "QUIT", 		&CommandHandler::_quitServer },				// CommandHandler_Log.cpp
+	{ "STATS", 		&CommandHandler::_sendStats },				// CommandHandler_Oper.cpp
+	{ "TOPIC", 		&CommandHandler::_setTopic },				// CommandHandler_Channel.cpp
+	{ "USER", 		&CommandHandler::_setUsernameClient },		// CommandHandler_Auth.cpp
+	{ "WHO", 		&CommandHandler::_handleWho },				// CommandHandler_Log.cpp
+	{ "WHOIS", 		&CommandHandler::_handleWhois },			// CommandHandler_Log.cpp
+	{ "WHOWAS", 	&CommandHandler::_handleWhowas },			// CommandHandler_Log.cpp
+};
+const size_t CommandHandler::_commandCount = sizeof(CommandHandler::_commandTable) / sizeof(CommandHandler::_commandTable[0]);
+
 CommandHandler::CommandHandler(Server& server, std::map<int, Client*>::iterator it)
 	: _server(server), _it(it), _clientFd(_it->first), _client(_it->second), _clients(_server.getClients()), _channels(_server.getChannels())
-{
-	// === AUTHENTICATE COMMANDS : CommandHandler_Auth.cpp ===
-	fct_map[PASS] 			= &CommandHandler::_isRightPassword;
-	fct_map[NICK] 			= &CommandHandler::_setNicknameClient;
-	fct_map[USER] 			= &CommandHandler::_setUsernameClient;
-	fct_map[CAP] 			= &CommandHandler::_handleCapabilities;
-	
-	// === CHANNEL COMMANDS : CommandHandler_Channel.cpp ===
-	fct_map[INVITE] 		= &CommandHandler::_inviteChannel;
-	fct_map[JOIN] 			= &CommandHandler::_joinChannel;
-	fct_map[TOPIC] 			= &CommandHandler::_setTopic;
-	fct_map[KICK] 			= &CommandHandler::_kickChannel;
-	fct_map[PART] 			= &CommandHandler::_quitChannel;
-
-	// === MODE COMMANDS : CommandHandler_ModeParser.cpp ===
-	fct_map[MODE] 			= &CommandHandler::_changeMode;
-
-	// === MESSAGE COMMANDS : CommandHandler_Message.cpp ===
-	fct_map[PRIVMSG] 		= &CommandHandler::_sendPrivateMessage;
-
-	// === LOG COMMANDS : CommandHandler_Log.cpp ===
-	fct_map[PING] 			= &CommandHandler::_sendPong;
-	fct_map[PONG] 			= &CommandHandler::_updateActivity;
-	fct_map[WHO] 			= &CommandHandler::_handleWho;
-	fct_map[WHOIS] 			= &CommandHandler::_handleWhois;
-	fct_map[WHOWAS] 		= &CommandHandler::_handleWhowas;
-	fct_map[AWAY] 			= &CommandHandler::_setAway;
-	fct_map[QUIT] 			= &CommandHandler::_quitServer;
-
-	// === FILE COMMANDS (BONUS) : CommandHandler_File.cpp ===
-	fct_map[DCC] = &CommandHandler::_handleFile;
-}
+{}
 
 CommandHandler::~CommandHandler(){}
 
 //-----------------------------COMMAND MANAGER---------------------------------
 
 /**
- * @brief Manages the incoming command string and executes the corresponding command function.
+ * @brief Manages the incoming command line and executes the corresponding command function.
+ *
+ * This function parses the line received from the client once (IrcMessage: views into the
+ * input buffer, no allocation), and determines the appropriate command to execute. It handles
+ * authentication checks, command validation, and parameter validation before invoking the
+ * corresponding command function, which reads its parameters from the parsed line.
  *
- * This function processes the command string received from the client, tokenizes it, and determines
- * the appropriate command to execute. It handles authentication checks, command validation, and
- * parameter validation before invoking the corresponding command function.
+ * Every known command is timed and counted in the server CommandStats (see STATS m): a command
+ * that ends with an IRC error reply (exception) is counted as an error. Unknown commands are not
+ * recorded, their cost is the lookup only.
  *
- * @param string_sent The command string received from the client.
+ * @param line The line received from the client (without "\r\n"), valid during the call.
+ * @param length The length of the line.
  *
  * @throws std::invalid_argument if the command is unknown or if there are insufficient parameters.
  */
-void CommandHandler::manage_command(std::string string_sent)
+void CommandHandler::manage_command(const char* line, size_t length)
 {
-	if (string_sent.empty())
+	if (length == 0)
 		return;
-		
-	_elements = Utils::getTokens(string_sent, splitter::SENTENCE);	
-	_itv = _elements.begin();
 
 	std::string nickname = _client->isAuthenticated() ? _client->getNickname() : "*";
-	if (Utils::isEmptyOrInvalid(_itv, _elements))
+	if (!_message.parse(line, length) || Utils::isPrintableSentence(_message.command()) == false)
 		throw std::invalid_argument(MessageHandler::ircUnknownCommand(nickname, " "));
-	
-	Utils::transformingMaj(*_elements.begin());
-		
+
+	size_t command = _findCommand(_message.command());
+	if (command == _commandCount)
+	{
+		_dispatch(command, nickname);
+		return ;
+	}
+
+	CommandStats& stats = _server.getCommandStats();
+	unsigned long start = CommandStats::now();
+	try
+	{
+		_dispatch(command, nickname);
+	}
+	catch (...)
+	{
+		stats.record(command, CommandStats::now() - start, true);
+		throw;
+	}
+	stats.record(command, CommandStats::now() - start, false);
+}
+
+/**
+ * @brief Executes a command once it has been looked up.
+ *
+ * @param command Index of the command in the dispatch table (_commandCount if unknown).
+ * @param nickname The nickname used in error replies ("*" before authentication).
+ *
+ * @throws std::invalid_argument if the command is unknown or if there are insufficient parameters.
+ */
+void CommandHandler::_dispatch(size_t command, const std::string& nickname)
+{
 	if (_client->isAuthenticated() == false)
 	{
 		_authenticateCommand();
 		return ;
 	}
 
-	std::string cmd = *_itv;
-	std::map<std::string, void (CommandHandler::*)()>::iterator it_function = fct_map.find(cmd);;
-	if (it_function == fct_map.end())
-		throw std::invalid_argument(MessageHandler::ircUnknownCommand(nickname, string_sent));
-	
-	_itv++;
+	if (command == _commandCount)
+		throw std::invalid_argument(MessageHandler::ircUnknownCommand(nickname, _message.line().str()));
+
+	// Le nom n'est copié que pour la réponse d'erreur
+	const char* name = _commandTable[command].name;
+	if (Utils::paramCheckNeeded(name) && _isEmptyOrInvalid(0))
+		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(nickname, name));
 
-	if (Utils::paramCheckNeeded(cmd) && Utils::isEmptyOrInvalid(_itv, _elements))
-		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(nickname, cmd));
+	(this->*_commandTable[command].handler)();
+}
 
-	(this->*it_function->second)();
+/**
+ * @brief Returns a copy of a parameter of the current line (empty if it is absent).
+ */
+std::string CommandHandler::_param(size_t index) const
+{
+	return _message.param(index).str();
+}
+
+/**
+ * @brief Checks if the parameters of the current line, from `index` to the end of the line,
+ * are missing, only spaces, or not printable.
+ */
+bool CommandHandler::_isEmptyOrInvalid(size_t index) const
+{
+	return Utils::isEmptyOrInvalid(_message.paramsFrom(index));
+}
+
+/**
+ * @brief Looks up a command in the static dispatch table.
+ *
+ * Binary search over the sorted table: at most 5 comparisons, no allocation. The name is
+ * compared without case (clients may send "privmsg"), straight from the received line.
+ *
+ * @param cmd The command name, as sent.
+ * @return size_t The index of the command in the table, or _commandCount if the command is unknown.
+ */
+size_t CommandHandler::_findCommand(const StringView& cmd)
+{
+	size_t low = 0;
+	size_t high = _commandCount;
+
+	while (low < high)
+	{
+		size_t mid = low + (high - low) / 2;
+		int cmp = cmd.compareUpper(_commandTable[mid].name);
+		if (cmp == 0)
+			return mid;
+		if (cmp < 0)
+			high = mid;
+		else
+			low = mid + 1;
+	}
+	return _commandCount;
+}
+
+size_t CommandHandler::commandCount()
+{
+	return _commandCount;
+}
+
+const char* CommandHandler::commandName(size_t command)
+{
+	return command < _commandCount ? _commandTable[command].name : "";
 }
\ No newline at end of file
@@ -15,7 +15,7 @@ using namespace colors;
  *
  * This function checks if the current command is valid and if the client is authenticated.
  * If the command is not valid or the client is not authenticated, it sends appropriate error messages.
- * If the command is valid, it executes the corresponding function from the command map.
+ * If the command is valid, it executes the corresponding function from the dispatch table.
  * If the client becomes authenticated after processing the command, it sends a greeting message and a registration prompt.
  *
  * The function performs the following steps:
@@ -28,12 +28,13 @@ using namespace colors;
  */
 void CommandHandler::_authenticateCommand()
 {
-	std::string cmd = *_itv;
+	std::string cmd = _message.command().str();
+	Utils::transformingMaj(cmd);
 	std::string command_to_send = IrcHelper::commandToSend(*_client);
 	int to_do = IrcHelper::getCommand(*_client);
-	std::map<std::string, void (CommandHandler::*)()>::iterator it_function = fct_map.find(*_itv);
+	size_t command = _findCommand(cmd);
 
-	if (it_function == fct_map.end() || IrcHelper::isCommandIgnored(cmd, true)
+	if (command == _commandCount || IrcHelper::isCommandIgnored(cmd, true)
 		|| (cmd == NICK && to_do != NICK_CMD) || (cmd == USER && to_do != USER_CMD))
 	{
 		if (_client->isIdentified() == true)
@@ -46,9 +47,8 @@ void CommandHandler::_authenticateCommand()
 			_client->sendMessage(MessageHandler::ircCommandPrompt(command_to_send, cmd, true), NULL);
 		return;
 	}
-	
-	_itv++;
-	(this->*it_function->second)();
+
+	(this->*_commandTable[command].handler)();
 
 	to_do = IrcHelper::getCommand(*_client);
 	if (to_do < CMD_ALL_SET && IrcHelper::isCommandIgnored(cmd, false) && !_client->isIdentified())
@@ -60,10 +60,9 @@ void CommandHandler::_authenticateCommand()
 	if (to_do == CMD_ALL_SET && _client->isAuthenticated() == false)
 	{
 		_client->setUsermask();
-		_client->authenticate();
-		_server.greetClient(_client);
+		_server.registerClient(_client);
 		_client->sendMessage(MessageHandler::ircBasicMsg(_client->getNickname(), PROMPT_ONCE_REGISTERED, IRC_COLOR_INFO), NULL);
-		std::cout << MessageHandler::msgClientConnected(_client->getClientIp(), _client->getClientPort(), _clientFd, _client->getNickname()) << std::endl;
+		Logger::info(MessageHandler::msgClientConnected(_client->getClientIp(), _client->getClientPort(), _clientFd, _client->getNickname()));
 	}
 }
 
@@ -71,9 +70,8 @@ void CommandHandler::_authenticateCommand()
  * @brief Handles pre-registration commands for the client.
  *
  * This function processes commands before the client is fully registered.
- * It checks if there are additional elements in the command vector and
- * sets the appropriate identification command for the client based on
- * the provided command and action to be performed.
+ * If the command has parameters, the whole line is kept so that it can be
+ * replayed once the client is allowed to run it (see _loadIdentCommand).
  *
  * @param cmd The command to be processed (e.g., "NICK", "USER").
  * @param to_do An integer indicating the action to be performed.
@@ -81,9 +79,9 @@ void CommandHandler::_authenticateCommand()
  *              - If cmd is "USER" and to_do is not 2, sets the client's username command.
  */
 void CommandHandler::_preRegister(const std::string& cmd, int to_do) {
-	if (_elements.begin() + 1 != _elements.end())
+	if (_message.paramCount() > 0)
 	{
-		std::vector<std::string> identCmd(_elements.begin() + 1, _elements.end());
+		std::string identCmd = _message.line().str();
 		if (cmd == "NICK" && to_do != NICK_CMD)
 			_client->setIdentNickCmd(identCmd);
 		if (cmd == "USER" && to_do != USER_CMD)
@@ -91,13 +89,30 @@ void CommandHandler::_preRegister(const std::string& cmd, int to_do) {
 	}
 }
 
+/**
+ * @brief Replaces the current line by a NICK/USER line kept by _preRegister.
+ *
+ * The line is copied into the handler (_identLine) before being parsed, since the
+ * parsed message only holds views into it.
+ *
+ * @param line The line to replay (empty: nothing to replay).
+ * @return bool true if a line was loaded.
+ */
+bool CommandHandler::_loadIdentCommand(const std::string& line)
+{
+	if (line.empty())
+		return false;
+	_identLine = line;
+	return _message.parse(_identLine.data(), _identLine.size());
+}
+
 /**
  * @brief Checks if the provided password is correct and updates the client's password validity status.
  * 
  * This function performs the following checks:
- * 1. If the iterator `_itv` is at the end of `_elements`, it throws an `std::invalid_argument` indicating that more parameters are needed.
+ * 1. If the password parameter is missing, it throws an `std::invalid_argument` indicating that more parameters are needed.
  * 2. If the client has already provided a valid server password, it throws an `std::invalid_argument` indicating that the client is already registered.
- * 3. Extracts the password from the current iterator position.
+ * 3. Extracts the password from the first parameter.
  * 4. Compares the extracted password with the server's password. If they do not match, it throws an `std::invalid_argument` indicating that the password is incorrect.
  * 5. If the password is correct, it sends a success message to the client and sets the client's server password validity to true.
  * 
@@ -105,12 +120,12 @@ void CommandHandler::_preRegister(const std::string& cmd, int to_do) {
  */
 void CommandHandler::_isRightPassword()
 {
-	if (Utils::isEmptyOrInvalid(_itv, _elements))
+	if (_isEmptyOrInvalid(0))
 		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(_client->getNickname(), "PASS"));
 	if (_client->gotValidServPassword() == true)
 		throw std::invalid_argument(MessageHandler::ircAlreadyRegistered(_client->getNickname()));
 
-	std::string password = *_itv;
+	std::string password = _param(0);
 	const std::string& servPassword = _server.getServerPassword();
 
 	if (password != servPassword)				
@@ -120,8 +135,7 @@ void CommandHandler::_isRightPassword()
 	_client->setServPasswordValidity(true);
 
 	// Si le client a déjà donné un nickname via identification irssi, on le set directement
-	std::vector<std::string> identNickCmd = _client->getIdentNickCmd();
-	if (!identNickCmd.empty())
+	if (!_client->getIdentNickCmd().empty())
 		_setNicknameClient();
 }
 
@@ -136,19 +150,15 @@ void CommandHandler::_isRightPassword()
  * If the nickname is valid and not taken, it sets the nickname for the client. If this is the first time the nickname is being set,
  * it sends a confirmation message to the client. If the client has already provided a username via identification, it sets the username directly.
  * 
- * If the nickname is being changed, it broadcasts the change to all clients.
+ * If the nickname is being changed, the change is sent to the client and once to each client sharing a channel with it.
  * 
  * @throws std::invalid_argument if the nickname is invalid, contains forbidden characters, or is already taken.
  */
 void CommandHandler::_setNicknameClient(void)
 {
 	// Si le client a déjà donné un nickname via identification irssi, on le récupère
-	std::vector<std::string> identNickCmd = _client->getIdentNickCmd();
-	if (!identNickCmd.empty())
-	{
-		_itv = identNickCmd.begin();
-		_client->setIdentNickCmd(std::vector<std::string>());
-	}
+	if (_loadIdentCommand(_client->getIdentNickCmd()))
+		_client->setIdentNickCmd("");
 
 	// On stocke l'ancien nickname s'il existe
 	std::string oldNickname = _client->getNickname();
@@ -157,10 +167,10 @@ void CommandHandler::_setNicknameClient(void)
 	std::string nickname = !oldNickname.empty() ? oldNickname : "*";
 
 	// Check si argument existe
-	if (Utils::isEmptyOrInvalid(_itv, _elements))
+	if (_isEmptyOrInvalid(0))
 		throw std::invalid_argument(MessageHandler::ircNoNicknameGiven(nickname));
 
-	std::string enteredNickname = *_itv;
+	std::string enteredNickname = _param(0);
 
 	// On check s'il y a des caractères interdits
 	if (IrcHelper::isValidName(enteredNickname, NICKNAME) == false)
@@ -174,8 +184,8 @@ void CommandHandler::_setNicknameClient(void)
 		throw std::invalid_argument(MessageHandler::ircNicknameTaken(nickname, enteredNickname));
 	}
 
-	// Si tout est ok, on set le nickname et on le stocke
-	_client->setNickname(enteredNickname);
+	// Si tout est ok, on set le nickname et on met à jour l'index des pseudos du serveur
+	_server.setClientNickname(_client, enteredNickname);
 	std::string newNickname = _client->getNickname();
 
 	// Affichage d'un message de confirmation au client si c'est le premier set du nickname
@@ -185,16 +195,15 @@ void CommandHandler::_setNicknameClient(void)
 		_client->sendMessage(MessageHandler::ircNicknameSet("", newNickname), NULL);
 
 		// Si le client a déjà donné un username via identification irssi, on le set directement
-		std::vector<std::string> identUserCmd = _client->getIdentUsernameCmd();
-		if (!identUserCmd.empty())
+		if (!_client->getIdentUsernameCmd().empty())
 			_setUsernameClient();
 		return;
 	}
 
 	// Sinon, c'est un changement de nickname:
-	// on broadcast à tous les clients pour valider le changement
+	// on l'annonce au client et une seule fois à chaque client partageant un canal avec lui
 	if ((!oldNickname.empty() && oldNickname != newNickname))
-		_server.broadcastToClients(MessageHandler::ircNicknameSet(oldNickname, newNickname));
+		_client->sendToPeers(MessageHandler::ircNicknameSet(oldNickname, newNickname), true);
 }
 
 /**
@@ -212,30 +221,24 @@ void CommandHandler::_setNicknameClient(void)
 void CommandHandler::_setUsernameClient(void)
 {
 	// Si le client a déjà donné un username via identification irssi, on le récupère
-	std::vector<std::string> identUserCmd = _client->getIdentUsernameCmd();
-	if (!identUserCmd.empty())
-	{
-		_itv = identUserCmd.begin();
-		_client->setIdentUsernameCmd(std::vector<std::string>());
-	}
+	if (_loadIdentCommand(_client->getIdentUsernameCmd()))
+		_client->setIdentUsernameCmd("");
 
 	// Check si argument existe ou si le username a déjà été set
-	if (Utils::isEmptyOrInvalid(_itv, _elements))
+	if (_isEmptyOrInvalid(0))
 		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(_client->getNickname(), USER));
 	if (!(_client->getUsername().empty()))
 		throw std::invalid_argument(MessageHandler::ircAlreadyRegistered(_client->getUsername()));
 	
-	// Récupération des arguments
-	std::vector<std::string> args = Utils::getTokens(*_itv, splitter::WORD);
-	if (args.size() < 4)
+	// USER <username> <hostname> <servername> :<realname>
+	if (_message.paramCount() < 4)
 		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(_client->getNickname(), USER));
-	
-	std::vector<std::string>::iterator itArg = args.begin();
 
 	// Récupération et validation du username, hostname et realname
-	_usernameSettings(itArg);
-	_hostnameSettings(itArg);
-	_realNameSettings(itArg, args);
+	// (le servername, inutilisé, est ignoré)
+	_usernameSettings(_param(0));
+	_hostnameSettings(_param(1));
+	_realNameSettings(3);
 
 	// Envoi d'un message de confirmation au client
 	_client->sendMessage(MessageHandler::ircUsernameSet(_client->getUsername()), NULL);
@@ -244,17 +247,15 @@ void CommandHandler::_setUsernameClient(void)
 /**
  * @brief Handles the setting of the username for a client.
  *
- * This function takes a const iterator to a vector of strings, extracts the username,
- * validates it, and sets it for the client. If the username is invalid, an exception
+ * This function validates the username and sets it for the client. If the username is invalid, an exception
  * is thrown. The username is always prefixed with a tilde (~) and truncated to a
  * maximum of 10 characters if it is too long.
  *
- * @param itArg Const iterator to the vector of strings containing the username.
+ * @param username The username parameter of USER.
  * @throws std::invalid_argument if the username is invalid.
  */
-void CommandHandler::_usernameSettings(const std::vector<std::string>::iterator& itArg)
+void CommandHandler::_usernameSettings(const std::string& username)
 {
-	std::string username = *itArg;
 	if (IrcHelper::isValidName(username, USERNAME) == false)
 		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(_client->getNickname(), USER));
 
@@ -273,12 +274,11 @@ void CommandHandler::_usernameSettings(const std::vector<std::string>::iterator&
  * nickname. Additionally, if the client's IP is unknown, it sets the client's
  * IP to the provided hostname.
  *
- * @param itArg Iterator pointing to the current argument in the list of arguments.
+ * @param hostname The hostname parameter of USER.
  * @throws std::invalid_argument if the hostname is invalid.
  */
-void CommandHandler::_hostnameSettings(std::vector<std::string>::iterator& itArg)
+void CommandHandler::_hostnameSettings(std::string hostname)
 {
-	std::string hostname = *++itArg;
 	if (IrcHelper::isValidName(hostname, HOSTNAME) == false)
 	{
 		_client->setUsername("");
@@ -293,33 +293,27 @@ void CommandHandler::_hostnameSettings(std::vector<std::string>::iterator& itArg
 	 // Si l'IP du client est inconnue, on remplace par le hostname tout juste fourni
 	if (_client->getClientIp() == server::UNKNOWN_IP)
 		_client->setClientIp(hostname);
-
-	// on saute le champ inutilisé (*, servername ou client IP -> déjà enregistré)
-	itArg++;
 }
 
 /**
  * @brief Sets the real name of the client after validating the input.
  *
- * This function extracts the real name from the provided arguments and performs
- * validation checks to ensure it is correctly formatted and valid. If the real name
- * is invalid, it throws an exception and sets the client's username to an empty string.
+ * The real name must be the last parameter, introduced by ':' (it may contain spaces),
+ * and must not be empty. If the real name is invalid, it throws an exception and sets
+ * the client's username to an empty string.
  *
- * @param itArg Iterator pointing to the current argument in the list of arguments.
- * @param args A vector of strings containing the command arguments.
+ * @param index Index of the real name in the parameters of USER.
  *
  * @throws std::invalid_argument if the real name is invalid or improperly formatted.
  */
-void CommandHandler::_realNameSettings(std::vector<std::string>::iterator& itArg, const std::vector<std::string>& args)
+void CommandHandler::_realNameSettings(size_t index)
 {
-	std::string realName = Utils::stockVector(++itArg, args);
-
-	if ((realName[0] != ':') || (realName[0] == ':' && realName.size() == 1))
+	if (!_message.isTrailing(index) || _message.param(index).empty())
 	{
 		_client->setUsername("");
 		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(_client->getNickname(), USER));
 	}
-	realName.erase(0, 1);
+	std::string realName = _param(index);
 
 	if (IrcHelper::isValidName(realName, REALNAME) == false)
 	{
@@ -351,7 +345,7 @@ void CommandHandler::_realNameSettings(std::vector<std::string>::iterator& itArg
 void CommandHandler::_handleCapabilities()
 {
 	std::string nickname = _client->isAuthenticated() ? _client->getNickname() : "*";
-	std::string arg = *_itv;
+	std::string arg = _param(0);
 
 	if (arg != "LS" && arg != "END")
 		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(nickname, CAP));
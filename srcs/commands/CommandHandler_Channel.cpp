@@ -11,13 +11,12 @@ using namespace server_messages;
  * @brief Handles the INVITE command to invite a client to a channel.
  * 
  * This function processes the INVITE command by performing the following steps:
- * 1. Tokenizes the input arguments.
- * 2. Validates the number of arguments.
- * 3. Checks if the client to be invited exists on the server.
- * 4. Verifies the existence of the specified channel.
- * 5. Ensures the requesting client is a member of the specified channel.
- * 6. Checks if the requesting client has operator privileges if the channel is invite-only.
- * 7. Invites the specified client to the channel if all checks pass.
+ * 1. Validates the number of arguments.
+ * 2. Checks if the client to be invited exists on the server.
+ * 3. Verifies the existence of the specified channel.
+ * 4. Ensures the requesting client is a member of the specified channel.
+ * 5. Checks if the requesting client has operator privileges if the channel is invite-only.
+ * 6. Invites the specified client to the channel if all checks pass.
  * 
  * @throws std::invalid_argument if the number of arguments is invalid.
  * @throws std::invalid_argument if the client to be invited does not exist.
@@ -27,18 +26,16 @@ using namespace server_messages;
  */
 void CommandHandler::_inviteChannel()
 {
-	std::vector<std::string> args = Utils::getTokens(*_itv, splitter::WORD);
-	int n_arg = args.size();
+	size_t n_arg = _message.paramCount();
 
-	// Si plus de deux arguments apres split, le format est invalide
+	// Si plus de deux arguments, le format est invalide
 	if (n_arg == 0 || n_arg > 2)
 		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(_client->getNickname(), INVITE));
 	
-	std::string invitedName = *args.begin();
+	std::string invitedName = _param(0);
 
 	// Verifie que le channel existe
-	std::vector<std::string>::iterator itChannel = ++args.begin();
-	std::string channelName = itChannel != args.end() ? IrcHelper::fixChannelMask(*itChannel) : "";
+	std::string channelName = n_arg == 2 ? IrcHelper::fixChannelMask(_param(1)) : "";
 
 	if (IrcHelper::channelExists(channelName, _channels) == false) 
 		throw std::invalid_argument(MessageHandler::ircNoSuchChannel(_client->getNickname(), channelName));
@@ -75,35 +72,32 @@ void CommandHandler::_inviteChannel()
  * If no passwords are provided, it will attempt to join the channels without passwords.
  * If a password is "x", it will be treated as an empty password.
  * 
- * @note The function assumes that the input tokens are separated by spaces and commas.
+ * @note Both lists are walked in place, in the parsed line (no token vector).
  */
 void CommandHandler::_joinChannel()
 {	
-	std::vector<std::string> args = Utils::getTokens(*_itv, splitter::WORD);
-
-	// Si plus de deux arguments apres split, le format est invalide
-	if (args.size() > 2)
+	// Si plus de deux arguments, le format est invalide
+	if (_message.paramCount() > 2)
 		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(_client->getNickname(), JOIN));
 
-	// On recupere les channels a join
-	std::vector<std::string>::iterator itArg = args.begin();
-	std::vector<std::string> channelsToJoin = Utils::getTokens(*itArg, splitter::COMMA);
-	++itArg;
-
-	// On recupere les mots de passe associes aux channels s'il y en a
-	std::vector<std::string> passwords = (itArg != args.end()) ? Utils::getTokens(*itArg, splitter::COMMA) : std::vector<std::string>();
-	std::vector<std::string>::iterator itPassword = passwords.begin();
+	// On recupere les channels a join et les mots de passe associes s'il y en a
+	StringView channels = _message.param(0);
+	StringView passwords = _message.param(1);
+	bool hasPasswords = _message.paramCount() == 2;
+	size_t posChannel = 0;
+	size_t posPassword = 0;
+	StringView channelName;
+	StringView password;
 
 	// On boucle sur tous les channels a join
-	for (std::vector<std::string>::iterator itChannel = channelsToJoin.begin(); itChannel != channelsToJoin.end(); ++itChannel)
+	while (channels.split(',', posChannel, channelName))
 	{
-		std::string channelName = *itChannel;
-		std::string password = (itPassword != passwords.end()) ? *itPassword : "";
-		password = password == "x" ? "" : password;
+		if (!hasPasswords || !passwords.split(',', posPassword, password))
+			password = StringView();
+		if (password == "x")
+			password = StringView();
 
-		_client->joinChannel(channelName, password, _channels);
-		if (itPassword != passwords.end())
-			++itPassword;
+		_client->joinChannel(channelName.str(), password.str(), _channels);
 	}
 }
 
@@ -128,9 +122,7 @@ void CommandHandler::_joinChannel()
  */
 void CommandHandler::_setTopic()
 {
-	std::vector<std::string> args = Utils::getTokens(*_itv, splitter::SENTENCE);
-	std::vector<std::string>::iterator itChannel = args.begin();
-	std::string channelName = itChannel != args.end() ? IrcHelper::fixChannelMask(*itChannel) : "";
+	std::string channelName = IrcHelper::fixChannelMask(_param(0));
 
 	if (IrcHelper::channelExists(channelName, _channels) == false) 
 		throw std::invalid_argument(MessageHandler::ircNoSuchChannel(_client->getNickname(), channelName));
@@ -138,14 +130,13 @@ void CommandHandler::_setTopic()
 	Channel* channel = _channels[channelName];
 
 	// Si pas de nouveau topic en argument, on send le topic actuel du channel
-	std::vector<std::string>::iterator itTopic = ++args.begin();
-	if (itTopic == args.end())
+	if (_message.paramCount() < 2)
 	{
 		_client->sendMessage(MessageHandler::ircTopicMessage(_client->getUsermask(), channelName, channel->getTopic()), NULL);
 		return;
 	}
 
-	std::string newTopic = Utils::truncateStr(IrcHelper::sanitizeIrcMessage(*itTopic, TOPIC, _client->getNickname()));
+	std::string newTopic = Utils::truncateStr(IrcHelper::sanitizeIrcMessage(_message, 1, TOPIC, _client->getNickname()));
 
 	// Si le nouveau topic contient juste "", on le remplace par une chaine vide pour unset le topic
 	if (newTopic == "\"\"")
@@ -163,7 +154,7 @@ void CommandHandler::_setTopic()
 	// On set le nouveau topic et on send les RPL correspondants
 	channel->topicSettings(newTopic, _client);
 	channel->sendToAll(MessageHandler::ircTopicMessage(_client->getUsermask(), channelName, channel->getTopic()), _client, true);
-	std::cout << MessageHandler::msgClientSetTopic(_client->getNickname(), channelName, channel->getTopic()) << std::endl;
+	Logger::info(MessageHandler::msgClientSetTopic(_client->getNickname(), channelName, channel->getTopic()));
 }
 
 /**
@@ -177,7 +168,7 @@ void CommandHandler::_setTopic()
  * @throws std::runtime_error if the user issuing the command is not an operator of the channel.
  * 
  * The function performs the following steps:
- * 1. Parses the command arguments to extract the channel name and the list of users to be kicked.
+ * 1. Extracts the channel name, the list of users to be kicked and the reason (default one if absent).
  * 2. Checks if the channel exists and if the user issuing the command is an operator of the channel.
  * 3. Iterates over the list of users to be kicked, checking if each user is in the channel.
  * 4. If the user to be kicked is an operator, they are not kicked.
@@ -185,37 +176,29 @@ void CommandHandler::_setTopic()
  */
 void CommandHandler::_kickChannel()
 {
-	std::vector<std::string> args = Utils::getTokens(*_itv, splitter::SENTENCE);
-	std::vector<std::string>::iterator itArg = args.begin();
-
-	// On récupère le nom du channel
-	std::string channelName = *itArg;
-	++itArg;
-	if (itArg == args.end())
+	// On récupère le nom du channel et les noms des clients à kicker
+	if (_message.paramCount() < 2)
 		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(_client->getNickname(), KICK));
-
-	args = Utils::getTokens(*itArg, splitter::WORD);
-	itArg = args.begin();
-	
-	// On récupère les noms des clients à kicker
-	std::vector<std::string> kickedClients = Utils::getTokens(*itArg, splitter::COMMA);
-	++itArg;
+	StringView kickedClients = _message.param(1);
 
 	// On récupère la raison du kick s'il y en a une, sinon on la parametre par defaut
-	std::string reason = Utils::stockVector(itArg, args);
-	reason = Utils::truncateStr(IrcHelper::sanitizeIrcMessage(reason, KICK, _client->getNickname()));
-	if (reason.empty() || Utils::isOnlySpace(reason) == true || ((reason)[0] == ':' && (reason).size() == 1))
+	std::string reason;
+	if (_isEmptyOrInvalid(2))
 		reason = DEFAULT_KICK_REASON;
+	else
+		reason = Utils::truncateStr(IrcHelper::sanitizeIrcMessage(_message, 2, KICK, _client->getNickname()));
 	
 	// Si le channel n'existe pas, on throw une erreur
-	channelName = IrcHelper::fixChannelMask(channelName);
+	std::string channelName = IrcHelper::fixChannelMask(_param(0));
 	if (IrcHelper::channelExists(channelName, _channels) == false) 
 		throw std::invalid_argument(MessageHandler::ircNoSuchChannel(_client->getNickname(), channelName));
 
 	Channel* channel = _channels[channelName];
 
 	// On boucle sur tous les clients a kick
-	for (std::vector<std::string>::iterator itClient = kickedClients.begin(); itClient != kickedClients.end(); itClient++)
+	size_t pos = 0;
+	StringView itClient;
+	while (kickedClients.split(',', pos, itClient))
 	{
 		// On vérifie que le client qui kick est bien operator du channel
 		if (!_client->isOperator(channel))
@@ -223,8 +206,8 @@ void CommandHandler::_kickChannel()
 		
 		// On récupère le fd du client à kick et on vérifie s'il est dans le channel,
 		// si non erreur et on passe au client suivant
-		std::string kickedNickname = *itClient;
-		int clientFd = channel->getChannelClientByNickname(kickedNickname, NULL);
+		std::string kickedNickname = itClient.str();
+		int clientFd = channel->getChannelClientByNickname(kickedNickname, NULL, _server.getNicknameIndex());
 		if (clientFd == -1)
 		{
 			_client->sendMessage(MessageHandler::ircNotInChannel(_client->getNickname(), channelName, kickedNickname), NULL);
@@ -260,27 +243,55 @@ void CommandHandler::_kickChannel()
 void CommandHandler::_quitChannel()
 {
 	// On récupère les channels à quitter
-	std::vector<std::string> args = Utils::getTokens(*_itv, splitter::SENTENCE);
-	std::vector<std::string>::iterator itArg = args.begin();
-	std::vector<std::string> channelsToQuit = Utils::getTokens(*itArg, splitter::COMMA);
-	++itArg;
+	StringView channelsToQuit = _message.param(0);
 
 	// On récupère la raison du PART s'il y en a une, sinon on la parametre par defaut
 	std::string reason;
 
-	if (Utils::isEmptyOrInvalid(itArg, args) || ((*itArg)[0] == ':' && (*itArg).size() == 1))
+	if (_isEmptyOrInvalid(1))
 		reason = DEFAULT_REASON;
 	else
-		reason = Utils::truncateStr(IrcHelper::sanitizeIrcMessage(*itArg, PART, _client->getNickname()));
+		reason = Utils::truncateStr(IrcHelper::sanitizeIrcMessage(_message, 1, PART, _client->getNickname()));
 	
 	// On boucle sur tous les channels à quitter
 	// On vérifie que le channel existe et on le quitte
-	for (std::vector<std::string>::iterator itChanToQuit = channelsToQuit.begin(); itChanToQuit != channelsToQuit.end(); itChanToQuit++) //verifie s ils existent bien avant de quit chaque channel
+	size_t pos = 0;
+	StringView itChanToQuit;
+	while (channelsToQuit.split(',', pos, itChanToQuit)) //verifie s ils existent bien avant de quit chaque channel
 	{
-		std::string channelNameToQuit = IrcHelper::fixChannelMask(*itChanToQuit);
+		std::string channelNameToQuit = IrcHelper::fixChannelMask(itChanToQuit.str());
 		if (IrcHelper::channelExists(channelNameToQuit, _channels) == false)
 			_client->sendMessage(MessageHandler::ircNoSuchChannel(_client->getNickname(), channelNameToQuit), NULL);
 		else
 			_client->leaveChannel(_channels.find(channelNameToQuit), _channels, reason, leaving_code::LEFT);
 	}
+}
+
+/**
+ * @brief Handles the NAMES command: lists the members of one or more channels.
+ * 
+ * The channels are given as a comma-separated list, walked in place. Each existing
+ * channel is answered by Channel::sendNames() (the same chunked 353 lines as after a
+ * JOIN, then 366). As stated by the RFC, an unknown channel only gets the 366, and a
+ * NAMES without parameter only ends the list ("*"): the server doesn't dump every
+ * channel.
+ */
+void CommandHandler::_sendNames()
+{
+	if (_isEmptyOrInvalid(0)) {
+		_client->sendMessage(MessageHandler::ircEndOfNames(_client->getNickname(), "*"), NULL);
+		return;
+	}
+
+	StringView channels = _message.param(0);
+	size_t pos = 0;
+	StringView itChannel;
+	while (channels.split(',', pos, itChannel))
+	{
+		std::string channelName = IrcHelper::fixChannelMask(itChannel.str());
+		if (IrcHelper::channelExists(channelName, _channels) == false)
+			_client->sendMessage(MessageHandler::ircEndOfNames(_client->getNickname(), channelName), NULL);
+		else
+			_channels[channelName]->sendNames(_client);
+	}
 }
\ No newline at end of file
@@ -1,23 +1,6 @@
 #include "../../incs/classes/CommandHandler.hpp"
 #include "../../incs/classes/CommandHandler_File.hpp"
 
-//---------------------------------------------------FILE METHODS---------------------------------------------------//
-
-File::File() {}
-File::File( std::string Name, std::string Path, std::string Sender, std::string Receiver ): Name(Name), Path(Path), sender(Sender), receiver(Receiver) {}
-File::File( const File &x ) { *this = x; }
-File::~File() {}
-File & File::operator=( const File &rhs )
-{
-	if (this == &rhs)
-		return (*this);
-	this->Name = rhs.Name;
-	this->Path = rhs.Path;
-	this->sender = rhs.sender;
-	this->receiver = rhs.receiver;
-	return (*this);
-};
-
 //---------------------------------------------------REQUEST METHODS---------------------------------------------------//
 
 Request::Request(std::vector<std::string> arg, std::string cmd): args(arg), command(cmd) {};
@@ -32,15 +15,64 @@ Request & Request::operator= ( const Request& rhs )
 	return (*this);
 };
 
+//---------------------------------------------------PATHS---------------------------------------------------//
+
+/**
+ * @brief Resolves a DCC file path against the $HOME of the server.
+ *
+ * Replaces the chdir($HOME) done before every SEND and GET: the working directory is
+ * shared by all the threads of the process, a path is now resolved without changing it.
+ *
+ * @param path The path given by the client (absolute, or relative to $HOME).
+ * @param resolved Set to the path to open.
+ * @return bool False if $HOME is not defined.
+ */
+static bool homePath(const std::string& path, std::string& resolved)
+{
+	const char* home = getenv("HOME");
+	if (!home || !*home)
+		return false;
+	if (!path.empty() && path[0] == '/')
+		resolved = path;
+	else
+		resolved = std::string(home) + "/" + path;
+	return true;
+}
+
+/**
+ * @brief Parses a DCC RESUME / ACCEPT position (a number of bytes).
+ *
+ * @param str The parameter given by the client.
+ * @param position Set to the parsed position.
+ * @return bool False if the parameter isn't a number, or doesn't fit in an off_t.
+ */
+static bool parsePosition(const std::string& str, off_t& position)
+{
+	if (str.empty() || str.size() > 18)
+		return false;
+	position = 0;
+	for (size_t i = 0; i < str.size(); ++i)
+	{
+		if (str[i] < '0' || str[i] > '9')
+			return false;
+		position = position * 10 + (str[i] - '0');
+	}
+	return true;
+}
+
 //---------------------------------------------------DISTRIBUTION METHOD---------------------------------------------------//
 
 void CommandHandler::_handleFile()
 {
-	std::vector<std::string> entry = Utils::getTokens(*_itv, splitter::SENTENCE);
-	if (entry.front() == "SEND")
-		_sendFile(entry);
-	else if (entry.front() == "GET")
-		_getFile(entry);
+	StringView subcommand = _message.param(0);
+	if (subcommand == "SEND")
+		_sendFile();
+	else if (subcommand == "GET")
+		_getFile();
+	else if (subcommand == "RESUME")
+		_resumeFile();
+	else if (subcommand == "ACCEPT")
+		_acceptFile();
 }
 
 //---------------------------------------------------SEND FILE METHODS---------------------------------------------------//
@@ -50,23 +82,26 @@ void CommandHandler::_handleFile()
  *
  * This function processes the SEND command by parsing the input entry, validating the request,
  * and sending the file to the specified client. It performs the following steps:
- * 1. Tokenizes the last entry to extract the request parameters.
+ * 1. Collects the request parameters (the parameters following SEND).
  * 2. Validates the number of arguments in the request.
  * 3. Iterates through the request arguments to send the file to the specified client.
- * 4. Checks if the target client exists and if the file can be opened.
- * 5. Sends the file to the target client and updates the server's file list.
- *
- * @param entry A vector of strings representing the command and its arguments.
+ * 4. Checks if the target client exists, then hands each file to the worker pool
+ *    (OfferFileJob): opening it may block on the disk.
+ * 5. Once the file is known to be readable, registers the offer and tells both clients
+ *    (OfferFileJob::complete(), back on the reactor of the sender).
  */
-void CommandHandler::_sendFile(std::vector<std::string> entry)
+void CommandHandler::_sendFile()
 {
-	if (chdir(getenv("HOME")) != 0) 
+	std::string path;
+	if (!homePath("", path))
 	{
 		_client->sendMessage("Error : $HOME not define." + eol::IRC, NULL);
 		return ;
 	}
 
-	std::vector<std::string> req = Utils::getTokens(entry.back(), splitter::WORD);
+	std::vector<std::string> req;
+	for (size_t i = 1; i < _message.paramCount(); ++i)
+		req.push_back(_param(i));
 	if (req.empty())
 	{
 		_client->sendMessage(MessageHandler::ircNeedMoreParams(_client->getNickname(), "SEND"), NULL);
@@ -87,18 +122,11 @@ void CommandHandler::_sendFile(std::vector<std::string> entry)
 			_client->sendMessage(MessageHandler::ircNoSuchNick(_client->getNickname(), request.args[1]), NULL);
 			return ;
 		}
-		std::fstream ifs(request.args[1].c_str(), std::fstream::in);
-		if (ifs.fail())
-		{
-			_client->sendMessage(MessageHandler::errorMsgSendFile(request.args[1]), NULL);
-			return ;
-		}
+		homePath(request.args[1], path);
 		size_t pos = request.args[1].find_last_of('/');
 		std::string filename = request.args[1].substr(pos + 1);
-		File file(filename, request.args[1], _client->getNickname(), request.args[0]);
-		_server.getFiles().insert(std::pair<std::string, File>(filename, file));
-		_client->sendMessage("DCC SEND request sent to " + request.args[0] + ": " + filename + eol::IRC, NULL);
-		_clients[clientFd]->sendMessage(MessageHandler::msgSendFile(filename, _client->getNickname(), _client->getClientIp(), _client->getClientPort()), _client);
+		File file(filename, path, _client->getNickname(), _clients[clientFd]->getNickname());
+		_server.submitJob(_client, new OfferFileJob(file, _clientFd, _client->getId(), clientFd, _clients[clientFd]->getId()));
 		request.args.erase(request.args.begin()+1);
 	}
 }
@@ -109,25 +137,36 @@ void CommandHandler::_sendFile(std::vector<std::string> entry)
  * @brief Handles the GET command to retrieve a file from another client.
  *
  * This function processes the GET command to retrieve a file that has been offered by another client.
- * It validates the request, checks if the file exists, and then transfers the file from the sender to the receiver.
- *
- * @param entry A vector of strings containing the command and its arguments.
+ * It validates the request, checks if the file exists, and then starts the copy of the file
+ * into the $HOME of the server.
  *
  * The function performs the following steps:
- * 1. Tokenizes the last entry in the command to extract the request parameters.
+ * 1. Collects the request parameters (the parameters following GET).
  * 2. Validates that the request has the necessary parameters.
- * 3. Checks if the specified file exists and if the sender and receiver match.
- * 4. Transfers the file from the sender to the receiver.
- * 5. Sends appropriate messages to the clients involved in the file transfer.
+ * 3. Looks up the offer of the sender for this client and this file (DccOffers, in place),
+ *    made by the connection now using the sender's nickname, and refuses it while a copy
+ *    of it is in progress, or while another copy writes this file or reads the one
+ *    this copy would write (Server::reserveCopy()).
+ * 4. Has the worker pool open the file and its copy, from the position agreed with
+ *    DCC ACCEPT (0 otherwise: a RESUME not accepted yet is dropped) (OpenFileJob),
+ *    then hands the copy to the reactor of the receiver (FileTransfer: copied by
+ *    chunks, see Server::_runTransfers()). The offer
+ *    stays registered until the copy ends: it is consumed by a complete copy, and can
+ *    be resumed after a failure.
+ * 5. Sends appropriate messages to the clients involved in the file transfer
+ *    (once the files are open, and at the end of the copy).
  */
-void	CommandHandler::_getFile(std::vector<std::string> entry)
+void	CommandHandler::_getFile()
 {
-	if (chdir(getenv("HOME")) != 0) 
+	std::string destPath;
+	if (!homePath("", destPath))
 	{
 		_client->sendMessage("Error : $HOME not define." + eol::IRC, NULL);
 		return ;
 	}
-	std::vector<std::string> req = Utils::getTokens(entry.back(), splitter::WORD);
+	std::vector<std::string> req;
+	for (size_t i = 1; i < _message.paramCount(); ++i)
+		req.push_back(_param(i));
 	if (req.empty())
 	{
 		_client->sendMessage(MessageHandler::ircNeedMoreParams(_client->getNickname(), "GET"), NULL);
@@ -139,7 +178,7 @@ void	CommandHandler::_getFile(std::vector<std::string> entry)
 		_client->sendMessage(MessageHandler::ircNeedMoreParams(_client->getNickname(), "GET"), NULL);
 		return ;
 	}
-	std::map<std::string, File> non = _server.getFiles();
+	DccOffers& offers = _server.getOffers();
 	while (request.args.size() >= 2)
 	{
 		int clientFd = _server.getClientByNickname(request.args[0], _client);
@@ -148,25 +187,303 @@ void	CommandHandler::_getFile(std::vector<std::string> entry)
 			_client->sendMessage(MessageHandler::ircNoSuchNick(_client->getNickname(), request.args[1]), NULL);
 			return ;
 		}
-		if (non.find(request.args[1]) == non.end())
+		DccOffer* offer = offers.find(request.args[0], _client->getNickname(), request.args[1]);
+		if (!offer || offer->senderId != _clients[clientFd]->getId())
 		{
 			_client->sendMessage("DCC no file offered by " + request.args[0] + eol::IRC, NULL);
 			return ;
 		}
-		File file(non[request.args[1]]);
-		if (file.receiver != _client->getNickname() || file.sender != request.args[0])
+		if (offer->copying)
 		{
-			_client->sendMessage("DCC no file offered by " + request.args[0] + eol::IRC, NULL);
+			_client->sendMessage("DCC " + request.args[1] + " from " + request.args[0] + " is already being copied", NULL);
 			return ;
 		}
-		_clients[clientFd]->sendMessage(MessageHandler::MsgSendingFile(request.args[1], _client->getNickname(), _client->getClientIp(), _client->getClientPort()), _client);
-		std::fstream	ofs(request.args[1].c_str(), std::fstream::out);
-		std::fstream	ifs(file.Path.c_str(), std::fstream::in);
-		if (ofs.is_open())
-			ofs << ifs.rdbuf();
-		_client->sendMessage("DCC received file " + file.Name + " from " + file.sender + eol::IRC, NULL);
-		_clients[clientFd]->sendMessage("DCC sent file " + file.Name + " for " + file.receiver + eol::IRC, _client);
-		non.erase(request.args[1]);
+		const File& file = offer->file;
+		homePath(file.Name, destPath);
+		if (!_server.reserveCopy(file.Path, destPath))
+		{
+			_client->sendMessage("DCC " + file.Name + " is in use by another copy", NULL);
+			return ;
+		}
+		FileTransfer* transfer = new FileTransfer(file.Name, file.sender, clientFd, _clients[clientFd]->getId(),
+			file.receiver, _clientFd, _client->getId(), offer->id);
+		transfer->sourcePath = file.Path;
+		transfer->destPath = destPath;
+		offer->copying = true;
+		offer->resumePosition = -1;
+		_server.submitJob(_client, new OpenFileJob(transfer, file.Path, destPath, offer->startOffset));
 		request.args.erase(request.args.begin()+1);
 	}
+}
+
+//---------------------------------------------------RESUME FILE METHODS---------------------------------------------------//
+
+/**
+ * @brief Handles the RESUME command: the receiver asks to go on with an interrupted copy.
+ *
+ * DCC RESUME <sender> <file> [position]
+ * The position defaults to the size of the partial copy in the $HOME of the server, and
+ * can't be past it: the size is read by the worker pool (ResumeFileJob), once no other
+ * copy uses that file (it would still be changing). The position is
+ * kept in the offer (no new offer is registered) and the sender is asked to agree with
+ * DCC ACCEPT; the next GET then copies from there.
+ */
+void	CommandHandler::_resumeFile()
+{
+	std::string destPath;
+	if (!homePath("", destPath))
+	{
+		_client->sendMessage("Error : $HOME not define." + eol::IRC, NULL);
+		return ;
+	}
+	if (_message.paramCount() < 3)
+	{
+		_client->sendMessage(MessageHandler::ircNeedMoreParams(_client->getNickname(), "RESUME"), NULL);
+		return ;
+	}
+	std::string senderNick = _param(1);
+	std::string filename = _param(2);
+
+	int clientFd = _server.getClientByNickname(senderNick, _client);
+	if (clientFd == -1)
+	{
+		_client->sendMessage(MessageHandler::ircNoSuchNick(_client->getNickname(), senderNick), NULL);
+		return ;
+	}
+	DccOffer* offer = _server.getOffers().find(senderNick, _client->getNickname(), filename);
+	if (!offer || offer->senderId != _clients[clientFd]->getId())
+	{
+		_client->sendMessage("DCC no file offered by " + senderNick + eol::IRC, NULL);
+		return ;
+	}
+	if (offer->copying)
+	{
+		_client->sendMessage("DCC " + filename + " from " + senderNick + " is already being copied", NULL);
+		return ;
+	}
+
+	off_t position = -1;
+	if (_message.paramCount() > 3 && !parsePosition(_param(3), position))
+	{
+		_client->sendMessage("DCC invalid RESUME position: " + _param(3), NULL);
+		return ;
+	}
+
+	// La taille de la copie interrompue est lue par le pool (ResumeFileJob)
+	homePath(offer->file.Name, destPath);
+	if (_server.isCopyPath(destPath))
+	{
+		_client->sendMessage("DCC " + filename + " is in use by another copy", NULL);
+		return ;
+	}
+	_server.submitJob(_client, new ResumeFileJob(offer->file, offer->id, destPath, position,
+		clientFd, _clients[clientFd]->getId(), _clientFd, _client->getId()));
+}
+
+/**
+ * @brief Handles the ACCEPT command: the sender agrees to resume a copy.
+ *
+ * DCC ACCEPT <receiver> <file> <position>
+ * The position must be the one asked with DCC RESUME, the offer must not be copied,
+ * and the partial copy must not be used by another copy. The offer then starts its
+ * next copy there, and the receiver is told to send GET again.
+ */
+void	CommandHandler::_acceptFile()
+{
+	if (_message.paramCount() < 4)
+	{
+		_client->sendMessage(MessageHandler::ircNeedMoreParams(_client->getNickname(), "ACCEPT"), NULL);
+		return ;
+	}
+	std::string receiverNick = _param(1);
+	std::string filename = _param(2);
+
+	int clientFd = _server.getClientByNickname(receiverNick, _client);
+	if (clientFd == -1)
+	{
+		_client->sendMessage(MessageHandler::ircNoSuchNick(_client->getNickname(), receiverNick), NULL);
+		return ;
+	}
+	DccOffer* offer = _server.getOffers().find(_client->getNickname(), receiverNick, filename);
+	if (offer && offer->copying)
+	{
+		_client->sendMessage("DCC " + filename + " from " + _client->getNickname() + " is already being copied", NULL);
+		return ;
+	}
+	off_t position;
+	if (!offer || offer->senderId != _client->getId() || offer->resumePosition < 0 || !parsePosition(_param(3), position)
+		|| position != offer->resumePosition)
+	{
+		_client->sendMessage("DCC no RESUME request from " + receiverNick + " for " + filename + " at " + _param(3), NULL);
+		return ;
+	}
+
+	std::string destPath;
+	if (homePath(filename, destPath) && _server.isCopyPath(destPath))
+	{
+		_client->sendMessage("DCC " + filename + " is in use by another copy", NULL);
+		return ;
+	}
+
+	offer->startOffset = position;
+	offer->resumePosition = -1;
+	_client->sendMessage("DCC ACCEPT sent to " + receiverNick + ": " + filename + " at " + _param(3), NULL);
+	_clients[clientFd]->sendMessage(MessageHandler::msgAcceptFile(filename, _client->getNickname(), position), _client);
+}
+
+//---------------------------------------------------WORKER JOBS---------------------------------------------------//
+
+OfferFileJob::OfferFileJob(const File& file, int senderFd, unsigned long senderId, int receiverFd, unsigned long receiverId)
+	: _file(file), _senderFd(senderFd), _senderId(senderId), _receiverFd(receiverFd), _receiverId(receiverId), _readable(false) {}
+OfferFileJob::~OfferFileJob() {}
+
+void OfferFileJob::run()
+{
+	std::ifstream ifs(_file.Path.c_str());
+	_readable = !ifs.fail();
+}
+
+/**
+ * @brief Registers the offer once the file is known to be readable.
+ *
+ * Both clients may have left or changed their nickname during the check: the offer is
+ * made with their current nicknames.
+ */
+void OfferFileJob::complete(Server& server)
+{
+	Client* sender = server.getConnectedClient(_senderFd, _senderId);
+	if (!sender)
+		return ;
+	if (!_readable)
+	{
+		sender->sendMessage(MessageHandler::errorMsgSendFile(_file.Path), NULL);
+		return ;
+	}
+	Client* receiver = server.getConnectedClient(_receiverFd, _receiverId);
+	if (!receiver)
+	{
+		sender->sendMessage(MessageHandler::ircNoSuchNick(sender->getNickname(), _file.receiver), NULL);
+		return ;
+	}
+	_file.sender = sender->getNickname();
+	_file.receiver = receiver->getNickname();
+	if (!server.addOffer(sender, _file))
+	{
+		sender->sendMessage("DCC too many pending offers, wait for them to be taken or to expire", NULL);
+		return ;
+	}
+	sender->sendMessage("DCC SEND request sent to " + _file.receiver + ": " + _file.Name + eol::IRC, NULL);
+	receiver->sendMessage(MessageHandler::msgSendFile(_file.Name, sender->getNickname(), sender->getClientIp(), sender->getClientPort()), sender);
+}
+
+OpenFileJob::OpenFileJob(FileTransfer* transfer, const std::string& sourcePath, const std::string& destPath, off_t offset)
+	: _transfer(transfer), _sourcePath(sourcePath), _destPath(destPath), _offset(offset), _opened(false) {}
+
+// La copie n'a pas été confiée au reactor (échec, arrêt du serveur) : elle est supprimée ici
+OpenFileJob::~OpenFileJob()
+{
+	delete _transfer;
+}
+
+void OpenFileJob::run()
+{
+	_opened = _transfer->open(_sourcePath, _destPath, _offset);
+}
+
+/**
+ * @brief Hands the opened copy to the reactor of the receiver.
+ *
+ * The copy is dropped if the files couldn't be opened, if they are used by another copy
+ * under other paths (links), if the receiver left, or if the offer was replaced in the
+ * meantime: its paths are released, and the offer (if still there) can be taken again.
+ * Nothing was written yet: the copy is only cut by its first chunk.
+ */
+void OpenFileJob::complete(Server& server)
+{
+	DccOffer* offer = server.getOffers().find(_transfer->sender, _transfer->receiver, _transfer->name);
+	bool current = offer && offer->id == _transfer->offerId;
+	Client* receiver = server.getConnectedClient(_transfer->receiverFd, _transfer->receiverId);
+	bool conflict = _opened && server.copyConflicts(_transfer);
+
+	if (!_opened || conflict || !receiver || !current)
+	{
+		server.releaseCopy(_transfer->sourcePath, _transfer->destPath);
+		if (current)
+			offer->copying = false;
+		if (receiver && !_opened)
+			receiver->sendMessage(MessageHandler::errorMsgSendFile(_destPath), NULL);
+		else if (receiver && conflict)
+			receiver->sendMessage("DCC " + _transfer->name + " is in use by another copy", NULL);
+		return ;
+	}
+	Client* sender = server.getConnectedClient(_transfer->senderFd, _transfer->senderId);
+	if (sender)
+		sender->sendMessage(MessageHandler::MsgSendingFile(_transfer->name, receiver->getNickname(), receiver->getClientIp(), receiver->getClientPort()), receiver);
+	server.startTransfer(receiver, _transfer);
+	_transfer = NULL;
+}
+
+ResumeFileJob::ResumeFileJob(const File& file, unsigned long offerId, const std::string& destPath, off_t position,
+	int senderFd, unsigned long senderId, int receiverFd, unsigned long receiverId)
+	: _file(file), _offerId(offerId), _destPath(destPath), _position(position), _available(0),
+	_senderFd(senderFd), _senderId(senderId), _receiverFd(receiverFd), _receiverId(receiverId) {}
+ResumeFileJob::~ResumeFileJob() {}
+
+// Ce que la copie interrompue contient déjà : on ne reprend pas au-delà
+void ResumeFileJob::run()
+{
+	struct stat partial;
+	if (stat(_destPath.c_str(), &partial) == 0 && S_ISREG(partial.st_mode))
+		_available = partial.st_size;
+}
+
+/**
+ * @brief Records the resume position in the offer and asks the sender to agree.
+ *
+ * The position defaults to the size of the partial copy. The offer must still be the
+ * one the receiver asked about, not being copied, and its partial copy not used by a
+ * copy started in the meantime.
+ */
+void ResumeFileJob::complete(Server& server)
+{
+	Client* receiver = server.getConnectedClient(_receiverFd, _receiverId);
+	if (!receiver)
+		return ;
+	Client* sender = server.getConnectedClient(_senderFd, _senderId);
+	if (!sender)
+	{
+		receiver->sendMessage(MessageHandler::ircNoSuchNick(receiver->getNickname(), _file.sender), NULL);
+		return ;
+	}
+	DccOffer* offer = server.getOffers().find(_file.sender, _file.receiver, _file.Name);
+	if (!offer || offer->id != _offerId)
+	{
+		receiver->sendMessage("DCC no file offered by " + sender->getNickname() + eol::IRC, NULL);
+		return ;
+	}
+	if (offer->copying)
+	{
+		receiver->sendMessage("DCC " + _file.Name + " from " + sender->getNickname() + " is already being copied", NULL);
+		return ;
+	}
+	if (server.isCopyPath(_destPath))
+	{
+		receiver->sendMessage("DCC " + _file.Name + " is in use by another copy", NULL);
+		return ;
+	}
+
+	off_t position = _position < 0 ? _available : _position;
+	if (position > _available)
+	{
+		std::ostringstream stream;
+		stream << "DCC can't resume " << _file.Name << " at " << position << ": the copy only has " << _available << " bytes";
+		receiver->sendMessage(stream.str(), NULL);
+		return ;
+	}
+
+	offer->resumePosition = position;
+	std::ostringstream stream;
+	stream << "DCC RESUME request sent to " << sender->getNickname() << ": " << _file.Name << " at " << position;
+	receiver->sendMessage(stream.str(), NULL);
+	sender->sendMessage(MessageHandler::msgResumeFile(_file.Name, receiver->getNickname(), position), receiver);
 }
\ No newline at end of file
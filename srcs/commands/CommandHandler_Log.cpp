@@ -33,6 +33,28 @@ void CommandHandler::_updateActivity()
 	_client->setPingSent(false);
 }
 
+/**
+ * @brief Sends one WHO reply line per channel member, straight from the membership table.
+ */
+class WhoReplier : public Channel::MemberVisitor {
+	public:
+		WhoReplier(Client* requestor, const std::string& channelName)
+			: _requestor(requestor), _nickname(requestor->getNickname()), _channelName(channelName) {}
+
+		void visit(const Client* connected, int flags) {
+			std::string prefix = (flags & Channel::OPERATOR) ? "@" : "";
+			std::string connectedNickname = (prefix + connected->getNickname());
+			_requestor->sendMessage(MessageHandler::ircWho(_nickname, connectedNickname, connected->getUsername(), connected->getRealName(), connected->getClientIp(), _channelName, connected->isAway()), NULL);
+			if (_requestor->isAway())
+				_requestor->sendMessage(MessageHandler::ircClientIsAway(_nickname, connected->getNickname(), connected->getAwayMessage()), NULL);
+		}
+
+	private:
+		Client* _requestor;
+		const std::string _nickname;
+		const std::string& _channelName;
+};
+
 /**
  * @brief Handles the WHO command from the IRC client.
  * 
@@ -44,8 +66,8 @@ void CommandHandler::_updateActivity()
  * 3. Validates the number of arguments.
  * 4. If the request is for a channel:
  *    - Checks if the channel exists.
- *    - Retrieves the list of clients in the channel.
- *    - Sends information about each client in the channel to the requestor.
+ *    - Sends information about each client in the channel to the requestor,
+ *      reading the channel membership in place (no copy of the member list).
  *    - Sends the end of WHO list message.
  * 5. If the request is for a specific user:
  *    - Checks if the user exists.
@@ -57,37 +79,24 @@ void CommandHandler::_updateActivity()
 void CommandHandler::_handleWho()
 {
 	std::string requestorNickname = _client->getNickname();
-	std::vector<std::string> args = Utils::getTokens(*_itv, splitter::WORD);
-	int n_arg = args.size();
-
-	// Si plus de un argument apres split, le format est invalide
-	if (n_arg != 1)
+	// Si plus de un argument, le format est invalide
+	if (_message.paramCount() != 1)
 		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(requestorNickname, WHO));
 
 	// Si le client demande des infos sur un channel, on vérifie son existence
 	// et on affiche les infos de chaque client dans ce channel
-	std::string channelName = IrcHelper::fixChannelMask(*_itv);
+	std::string channelName = IrcHelper::fixChannelMask(_param(0));
 	if (IrcHelper::channelExists(channelName, _channels))
 	{
-		Channel* channel = _channels[channelName];
-		std::set<const Client*> clientsList = channel->getClientsList();
-
-		for (std::set<const Client*>::iterator it = clientsList.begin(); it != clientsList.end(); ++it)
-		{
-			const Client* connected = *it;
-			std::string prefix = channel->isOperator(connected) ? "@" : "";
-			std::string connectedNickname = (prefix + connected->getNickname());
-			_client->sendMessage(MessageHandler::ircWho(requestorNickname, connectedNickname, connected->getUsername(), connected->getRealName(), connected->getClientIp(), channelName, connected->isAway()), NULL);
-			if (_client->isAway())
-				_client->sendMessage(MessageHandler::ircClientIsAway(requestorNickname, connected->getNickname(), connected->getAwayMessage()), NULL);
-		}
+		WhoReplier replier(_client, channelName);
+		_channels[channelName]->forEachMember(replier);
 		_client->sendMessage(MessageHandler::ircEndOfWho(requestorNickname, channelName), NULL);
 		return;
 	}
 
 	// Si le client demande des infos sur un utilisateur
 	// On vérifie d'abord que l'utilisateur existe
-	std::string checkedClientNickname = *_itv;
+	std::string checkedClientNickname = _param(0);
 	int checkedClientFd = _server.getClientByNickname(checkedClientNickname, NULL);
 	if (checkedClientFd == -1)
 		throw std::invalid_argument(MessageHandler::ircNoSuchNick(requestorNickname, checkedClientNickname));
@@ -111,17 +120,14 @@ void CommandHandler::_handleWho()
 void CommandHandler::_handleWhois()
 {
 	std::string requestorNickname = _client->getNickname();
-	if (Utils::isEmptyOrInvalid(_itv, _elements))
+	if (_isEmptyOrInvalid(0))
 		return;
 
-	std::vector<std::string> args = Utils::getTokens(*_itv, splitter::WORD);
-	int n_arg = args.size();
-
-	// Si plus de un argument apres split, le format est invalide
-	if (n_arg != 1)
+	// Si plus de un argument, le format est invalide
+	if (_message.paramCount() != 1)
 		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(requestorNickname, WHOIS));
 	
-	std::string checkedClientNickname = *_itv;
+	std::string checkedClientNickname = _param(0);
 	int checkedClientFd = _server.getClientByNickname(checkedClientNickname, NULL);
 	if (checkedClientFd == -1)
 		throw std::invalid_argument(MessageHandler::ircNoSuchNick(requestorNickname, checkedClientNickname));
@@ -136,12 +142,12 @@ void CommandHandler::_handleWhois()
  * @brief Handles the WHOWAS command.
  *
  * This function sends the end of WHOWAS message to the client.
- * It uses the client's nickname and the current iterator value (_itv)
+ * It uses the client's nickname and the requested nickname (first parameter)
  * to construct the message.
  */
 void CommandHandler::_handleWhowas()
 {
-	_client->sendMessage(MessageHandler::ircEndOfWhowas(_client->getNickname(), *_itv), NULL);
+	_client->sendMessage(MessageHandler::ircEndOfWhowas(_client->getNickname(), _param(0)), NULL);
 }
 
 /**
@@ -167,7 +173,7 @@ void CommandHandler::_setAway()
 
 	// Si pas de paramètre ou invalide et que le client est déjà en mode actif, on ignore
 	// Sinon on le remet en mode actif
-	if (Utils::isEmptyOrInvalid(_itv, _elements))
+	if (_isEmptyOrInvalid(0))
 	{
 		if (_client->isAway() == true)
 		{
@@ -179,7 +185,7 @@ void CommandHandler::_setAway()
 	}
 
 	// On récupère la raison de l'absence
-	std::string awayMessage = Utils::truncateStr(IrcHelper::sanitizeIrcMessage(*_itv, AWAY, nickname));
+	std::string awayMessage = Utils::truncateStr(IrcHelper::sanitizeIrcMessage(_message, 0, AWAY, nickname));
 
 	// Si la raison contient juste "", on le remplace par une chaine vide pour remettre en mode actif
 	if (awayMessage == "\"\"")
@@ -206,8 +212,7 @@ void CommandHandler::_setAway()
  * @brief Handles the QUIT command for a client, preparing them to leave the server.
  *
  * This function checks if a reason for quitting is provided. If no reason is given,
- * or if the reason is empty or consists only of spaces, or if the reason is a single
- * colon, the default reason is used. If a reason is provided, it is checked and
+ * or if the reason is empty or consists only of spaces, the default reason is used. If a reason is provided, it is checked and
  * truncated if necessary. If the reason is "leaving", it is replaced with the default
  * reason.
  *
@@ -216,14 +221,14 @@ void CommandHandler::_setAway()
 void CommandHandler::_quitServer(void)
 {
 	// Si aucune raison n'est fournie, on utilise la raison par défaut
-	if (Utils::isEmptyOrInvalid(_itv, _elements) || ((*_itv)[0] == ':' && (*_itv).size() == 1)) {
+	if (_isEmptyOrInvalid(0)) {
 		_server.prepareClientToLeave(_it, DEFAULT_REASON);
 		return;
 	}
 
 	// On récupère la raison du QUIT,
 	// si c'est celle par défaut d'Irssi (leaving) on met la notre (Bye bye everyone)
-	std::string reason = Utils::truncateStr(IrcHelper::sanitizeIrcMessage(*_itv, QUIT, _client->getNickname()));
+	std::string reason = Utils::truncateStr(IrcHelper::sanitizeIrcMessage(_message, 0, QUIT, _client->getNickname()));
 	if (reason == "leaving")
 		reason = DEFAULT_REASON;
 
@@ -14,21 +14,17 @@ using namespace commands;
  */
 void CommandHandler::_sendPrivateMessage()
 {
-	if (_itv == _elements.end() || Utils::isOnlySpace(*_itv) == true || Utils::isPrintableSentence(*_itv) == false)
+	if (_isEmptyOrInvalid(0))
 		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(_client->getNickname(), PRIVMSG));
 
-	std::vector<std::string> args = Utils::getTokens(*_itv, splitter::SENTENCE);
-	std::string targetStr = *args.begin();
-	std::vector<std::string> targets = Utils::getTokens(targetStr, splitter::COMMA);
-	std::vector<std::string>::iterator itTarget = targets.begin();
+	StringView targets = _message.param(0);
+	StringView firstTarget;
+	size_t pos = 0;
+	targets.split(',', pos, firstTarget);
 
-	if (itTarget == targets.end())
-		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(_client->getNickname(), PRIVMSG));
-
-	std::vector<std::string>::iterator itMessage = ++args.begin();
-	std::string	message = itMessage != args.end() ? *itMessage : "";
+	std::string	message = _param(1);
 	
-	if (IrcHelper::isRightChannel(*_client, *itTarget, _channels, "NO") != channel_error::INVALID_FORMAT)
+	if (IrcHelper::isRightChannel(*_client, firstTarget.str(), _channels, "NO") != channel_error::INVALID_FORMAT)
 		_sendToChannel(targets, message);
 	else
 		_sendToClient(targets, message);
@@ -38,25 +34,27 @@ void CommandHandler::_sendPrivateMessage()
  * @brief Sends a message to a list of target channels.
  *
  * This function iterates over the provided list of target channels and sends the given message to each channel.
- * If the message is empty, contains only a colon, or consists solely of whitespace, an exception is thrown.
+ * If the message is empty or consists solely of whitespace, an exception is thrown.
  * The message is formatted before being sent to the channels.
  *
- * @param targets A vector of target channel names to which the message should be sent.
+ * @param targets The comma-separated list of target channel names (view into the parsed line).
  * @param message The message to be sent to the target channels.
  *
- * @throws std::invalid_argument if the message is empty, contains only a colon, or consists solely of whitespace.
+ * @throws std::invalid_argument if the message is empty or consists solely of whitespace.
  */
-void CommandHandler::_sendToChannel(std::vector<std::string>& targets, std::string& message)
+void CommandHandler::_sendToChannel(const StringView& targets, const std::string& message)
 {
 	std::string nickname = _client->getNickname();
+	size_t pos = 0;
+	StringView itTarget;
 
-	for (std::vector<std::string>::iterator itTarget = targets.begin(); itTarget != targets.end(); itTarget++)
+	while (targets.split(',', pos, itTarget))
 	{
-		if (message.empty() || (message[0] == ':' && message.size() == 1) || Utils::isOnlySpace(message) == true)
+		if (message.empty() || Utils::isOnlySpace(message) == true)
 			throw std::invalid_argument(MessageHandler::ircNoTextToSend(nickname));
 
-		std::string formatedMessage = IrcHelper::sanitizeIrcMessage(message, PRIVMSG, nickname);
-		std::string targetName = *itTarget;
+		std::string formatedMessage = IrcHelper::sanitizeIrcMessage(_message, 1, PRIVMSG, nickname);
+		std::string targetName = itTarget.str();
 
 		if (IrcHelper::channelExists(targetName, _channels) == false)
 		{
@@ -77,26 +75,29 @@ void CommandHandler::_sendToChannel(std::vector<std::string>& targets, std::stri
  * If the target client is the same as the sender, it skips sending the message.
  * If the target client is away, it sends an away message back to the sender.
  *
- * @param targets A vector of target client nicknames.
+ * @param targets The comma-separated list of target nicknames (view into the parsed line).
  * @param message The message to be sent to the target clients.
  * @throws std::invalid_argument If the message is empty or invalid.
  */
-void CommandHandler::_sendToClient(std::vector<std::string>& targets, std::string& message)
+void CommandHandler::_sendToClient(const StringView& targets, const std::string& message)
 {
 	std::string nickname = _client->getNickname();
+	size_t pos = 0;
+	StringView itTarget;
 
-	for (std::vector<std::string>::iterator itTarget = targets.begin(); itTarget != targets.end(); itTarget++)
+	while (targets.split(',', pos, itTarget))
 	{
-		std::string targetName = *itTarget;
-		if (message.empty() || (message[0] == ':' && message.size() == 1) || Utils::isOnlySpace(message) == true)
+		std::string targetName = itTarget.str();
+		if (message.empty() || Utils::isOnlySpace(message) == true)
 		{
-			if ((targetName)[0] == ':')
+			// "PRIVMSG :texte" : le seul paramètre est le texte, il n'y a pas de destinataire
+			if (_message.isTrailing(0))
 				throw std::invalid_argument(MessageHandler::ircNoRecipient(nickname));
 			else
 				throw std::invalid_argument(MessageHandler::ircNoTextToSend(nickname));
 		}
 
-		std::string formatedMessage = IrcHelper::sanitizeIrcMessage(message, PRIVMSG, nickname);
+		std::string formatedMessage = IrcHelper::sanitizeIrcMessage(_message, 1, PRIVMSG, nickname);
 		int clientFd = _server.getClientByNickname(targetName, NULL);
 		if (clientFd == -1)
 		{
@@ -46,7 +46,7 @@ void CommandHandler::_checkArgAndExecute(std::string &mode, std::string &channel
 		_mode_sign = mode[IrcHelper::findCharFromPosition(mode, '-', '+', mode.find('o'))];
 		if (_server.getClientByNickname(mode_args.at('o'), NULL) == -1)  //erreur si nom de l operateur inconnu sur le serveur
 			_client->sendMessage(MessageHandler::ircNoSuchNick(_client->getNickname(), mode_args.at('o')), NULL);
-		else if (_channels[channel]->getChannelClientByNickname(mode_args.at('o'), NULL) == -1) //erreur si nom de l operateur inconnu sur le channel
+		else if (_channels[channel]->getChannelClientByNickname(mode_args.at('o'), NULL, _server.getNicknameIndex()) == -1) //erreur si nom de l operateur inconnu sur le channel
 			_client->sendMessage(MessageHandler::ircNotInChannel(_client->getNickname(), channel, mode_args.at('o')), NULL);
 		else {
 			Client *newOp = _clients[_server.getClientByNickname(mode_args.at('o'), NULL)];
@@ -126,7 +126,7 @@ bool CommandHandler::_handleSimpleCommandAndRegularErrors(std::string &channel,
 		_client->sendMessage(MessageHandler::ircEndOfBannedList(_client->getNickname(), channel), NULL);
 		return false;	
 	}
-	if (_channels[channel]->getChannelClientByNickname(_client->getNickname(), NULL) == -1)
+	if (_channels[channel]->getChannelClientByNickname(_client->getNickname(), NULL, _server.getNicknameIndex()) == -1)
 		throw std::invalid_argument(MessageHandler::ircCurrentNotInChannel(_client->getNickname(), channel));
 	if (_client->isOperator(_channels[channel]) == false)
 		throw std::invalid_argument(MessageHandler::ircNotChanOperator(channel));
@@ -143,24 +143,21 @@ bool CommandHandler::_handleSimpleCommandAndRegularErrors(std::string &channel,
  * and executes the appropriate mode change operations.
  *
  * The function performs the following steps:
- * 1. Tokenizes the input command to extract the target (channel or user) and mode.
+ * 1. Extracts the target (channel or user) and mode from the parsed parameters.
  * 2. Validates the command and checks for errors.
  * 3. Determines the mode arguments and executes the corresponding mode change functions.
  *
- * @note The function assumes that the input command is stored in the member variable `_itv`.
+ * @note The function assumes that the input command is parsed in the member variable `_message`.
  *
  * @return void
  */
 void CommandHandler::_changeMode()
 {
-	std::string mode;
-	std::vector<std::string> args = Utils::getTokens(*_itv, splitter::WORD);
-	std::string cible = *args.begin();					//channel cible
-	if (args.size() > 1)
-		mode = *++args.begin();							//mode
-	if (_handleSimpleCommandAndRegularErrors(cible, mode, args.size()) == false)
+	std::string cible = _param(0);						//channel cible
+	std::string mode = _param(1);						//mode
+	if (_handleSimpleCommandAndRegularErrors(cible, mode, _message.paramCount()) == false)
 		return ;	
 	
-	std::map<char, std::string> mode_args = IrcHelper::whichModeForWhichArg(args);
+	std::map<char, std::string> mode_args = IrcHelper::whichModeForWhichArg(_message);
 	_checkArgAndExecute(mode, cible, mode_args);		//fonction qui traite les modes et dirige vers les bonnes fonctions	
 }
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "../../incs/classes/CommandHandler.hpp"
+
+// === NAMESPACES ===
+using namespace commands;
+
+// =========================================================================================
+/**
+ * @brief Handles the OPER command: OPER <name> <password>.
+ *
+ * The operator password is given to the server through the environment
+ * (IRCSERV_OPER_PASSWORD): without it, nobody can become an operator.
+ * The name is only used in the server logs.
+ *
+ * @throws std::invalid_argument if the parameters are invalid, if OPER is disabled,
+ *         or if the password does not match.
+ */
+void CommandHandler::_becomeOperator()
+{
+	std::string nickname = _client->getNickname();
+	if (_message.paramCount() != 2)
+		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(nickname, OPER));
+
+	// Aucun mot de passe opérateur configuré : OPER est désactivé
+	if (!_server.hasOperPassword())
+		throw std::invalid_argument(MessageHandler::ircNoOperHost(nickname));
+	if (!_server.isOperPassword(_param(1)))
+		throw std::invalid_argument(MessageHandler::ircPasswordIncorrect());
+
+	_client->setServerOperator(true);
+	_client->sendMessage(MessageHandler::ircYoureOper(nickname), NULL);
+	Logger::info(MessageHandler::msgClientIsOperator(nickname, _param(0)));
+}
+
+/**
+ * @brief Handles the STATS command (operator only).
+ *
+ * Supported queries:
+ * - p : occupancy of the Client and Channel pools (objects in use, peak, slots, slabs).
+ * - m : for every command called at least once, the number of calls, the number of
+ *       calls that ended with an error, and the p50/p99/max processing time (us).
+ *       The time covers the whole handler, replies queued included (not their sending).
+ * - d : every DCC copy in progress, with the bytes copied so far and its average throughput.
+ *
+ * Any other query only gets the end of the report, as with RFC 1459 servers.
+ *
+ * @throws std::invalid_argument if the client is not a server operator.
+ */
+void CommandHandler::_sendStats()
+{
+	std::string nickname = _client->getNickname();
+
+	if (!_client->isServerOperator())
+		throw std::invalid_argument(MessageHandler::ircNoPrivileges(nickname));
+
+	std::string query = _param(0);
+
+	if (query == "m" || query == "M")
+	{
+		const CommandStats& stats = _server.getCommandStats();
+		for (size_t i = 0; i < stats.size(); ++i)
+		{
+			if (stats.calls(i) == 0)
+				continue;
+			const LatencyHistogram& latency = stats.latency(i);
+			_client->sendMessage(MessageHandler::ircStatsCommand(nickname, commandName(i), stats.calls(i), stats.errors(i),
+				latency.percentile(50), latency.percentile(99), latency.max()), NULL);
+		}
+	}
+	else if (query == "p" || query == "P")
+	{
+		PoolUsage pools[2] = { Client::poolUsage(), Channel::poolUsage() };
+		for (size_t i = 0; i < 2; ++i)
+			_client->sendMessage(MessageHandler::ircStatsPool(nickname, pools[i].name, pools[i].inUse, pools[i].peak, pools[i].capacity, pools[i].slabs), NULL);
+	}
+	else if (query == "d" || query == "D")
+	{
+		std::vector<const FileTransfer*> transfers = _server.getTransfers();
+		unsigned long now = CommandStats::now();
+		for (size_t i = 0; i < transfers.size(); ++i)
+			_client->sendMessage(MessageHandler::ircStatsTransfer(nickname, transfers[i]->name, transfers[i]->sender, transfers[i]->receiver,
+				transfers[i]->copied(), transfers[i]->size(), transfers[i]->throughput(now)), NULL);
+	}
+	_client->sendMessage(MessageHandler::ircEndOfStats(nickname, query), NULL);
+}
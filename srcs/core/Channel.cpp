@@ -7,7 +7,8 @@
 
 // --- PUBLIC
 Channel::Channel(const std::string &name, const std::string& password) : _name(name), _password(password),
-	_topic(""), _channelTimestamp(time(0)), _invites(false), _rightsTopic(false), _limits(-1), _nbUser(0) {}
+	_topic(""), _channelTimestamp(time(0)), _memberIndex(8), _connectedCount(0), _operatorCount(0), _invitedCount(0),
+	_invites(false), _rightsTopic(false), _limits(-1), _nbUser(0) {}
 Channel::~Channel() {}
 
 // --- PRIVATE
@@ -16,6 +17,150 @@ Channel::Channel(const Channel& src) {(void) src;}
 Channel & Channel::operator=(const Channel& src) {(void) src; return *this;}
 
 
+// === MEMORY POOL ===
+
+// Pool de tous les canaux du processus (voir Client::operator new)
+static ObjectPool<Channel, server::CHANNEL_POOL_SLAB>& channelPool() {
+	static ObjectPool<Channel, server::CHANNEL_POOL_SLAB> pool("Channel");
+	return pool;
+}
+
+void* Channel::operator new(size_t size) {
+	return channelPool().allocate(size);
+}
+void Channel::operator delete(void* pointer, size_t size) {
+	channelPool().release(pointer, size);
+}
+PoolUsage Channel::poolUsage() {
+	return channelPool().usage();
+}
+
+
+// === MEMBERSHIP TABLE ===
+
+// Les clients viennent d'un pool : les bits de poids faible de l'adresse sont constants
+size_t Channel::Hash::operator()(const Client* client) const {
+	size_t address = reinterpret_cast<size_t>(client);
+	return (address >> 4) ^ (address >> 12);
+}
+
+bool Channel::Equal::operator()(const Client* a, const Client* b) const {
+	return a == b;
+}
+
+bool Channel::_hasFlag(const Client* client, int flag) const {
+	const size_t* index = _memberIndex.find(client);
+	return index && (_members[*index].flags & flag);
+}
+
+/**
+ * @brief Sets a membership flag of a client, adding its entry if needed.
+ *
+ * Members, operators and invited clients share one dense table: a client is stored
+ * once, whatever its roles, and the index only maps its address to its slot.
+ *
+ * @return bool false if the client already had the flag.
+ */
+bool Channel::_setFlag(const Client* client, int flag) {
+	size_t* index = _memberIndex.find(client);
+	if (!index) {
+		Member member = { client, 0 };
+		_memberIndex.insert(client, _members.size());
+		_members.push_back(member);
+		index = _memberIndex.find(client);
+	}
+	int& flags = _members[*index].flags;
+	if (flags & flag)
+		return false;
+	flags |= flag;
+	_connectedCount += (flag & MEMBER) ? 1 : 0;
+	_operatorCount += (flag & OPERATOR) ? 1 : 0;
+	_invitedCount += (flag & INVITED) ? 1 : 0;
+	return true;
+}
+
+/**
+ * @brief Clears a membership flag of a client.
+ *
+ * An entry left without any flag is removed by moving the last entry into its slot,
+ * so the table stays dense and a removal costs O(1).
+ *
+ * @return bool false if the client did not have the flag.
+ */
+bool Channel::_clearFlag(const Client* client, int flag) {
+	size_t* index = _memberIndex.find(client);
+	if (!index || !(_members[*index].flags & flag))
+		return false;
+
+	size_t slot = *index;
+	int& flags = _members[slot].flags;
+	flags &= ~flag;
+	_connectedCount -= (flag & MEMBER) ? 1 : 0;
+	_operatorCount -= (flag & OPERATOR) ? 1 : 0;
+	_invitedCount -= (flag & INVITED) ? 1 : 0;
+
+	if (flags == 0) {
+		_memberIndex.erase(client);
+		if (slot != _members.size() - 1) {
+			_members[slot] = _members.back();
+			*_memberIndex.find(_members[slot].client) = slot;
+		}
+		_members.pop_back();
+	}
+	return true;
+}
+
+
+
+// === MEMBER ITERATION ===
+
+Channel::MemberIterator::MemberIterator(const std::vector<Member>& members, size_t index, int flag)
+	: _members(&members), _index(index), _flag(flag) {
+	_skip();
+}
+
+void Channel::MemberIterator::_skip() {
+	while (_index < _members->size() && !((*_members)[_index].flags & _flag))
+		++_index;
+}
+
+const Channel::Member& Channel::MemberIterator::operator*() const {
+	return (*_members)[_index];
+}
+const Channel::Member* Channel::MemberIterator::operator->() const {
+	return &(*_members)[_index];
+}
+Channel::MemberIterator& Channel::MemberIterator::operator++() {
+	++_index;
+	_skip();
+	return *this;
+}
+bool Channel::MemberIterator::operator==(const MemberIterator& other) const {
+	return _index == other._index;
+}
+bool Channel::MemberIterator::operator!=(const MemberIterator& other) const {
+	return _index != other._index;
+}
+
+Channel::MemberIterator Channel::membersBegin(int flag) const {
+	return MemberIterator(_members, 0, flag);
+}
+Channel::MemberIterator Channel::membersEnd() const {
+	return MemberIterator(_members, _members.size(), 0);
+}
+
+/**
+ * @brief Calls the visitor for every client having `flag`, reading the table in place.
+ *
+ * The visitor also gets the other roles of the client (e.g. OPERATOR for the "@"
+ * of WHO), so it never needs a second lookup. It must not change the membership.
+ */
+void Channel::forEachMember(MemberVisitor& visitor, int flag) const {
+	for (MemberIterator it = membersBegin(flag); it != membersEnd(); ++it)
+		visitor.visit(it->client, it->flags);
+}
+
+
 // === SETTERS ===
 
 void Channel::setPassword(const std::string &password) {
@@ -87,30 +232,6 @@ time_t Channel::getTopicTimestamp() const {
 	return _topicTimestamp;
 }
 
-/**
- * @brief Retrieves a space-separated string of nicknames of all clients connected to the channel.
- *
- * This function iterates through the set of connected clients and constructs a string
- * containing their nicknames. If a client is an operator, their nickname is prefixed with "@".
- *
- * @return A std::string containing the nicknames of all connected clients, separated by spaces.
- */
-std::string Channel::getNicknames() const {
-	std::string nicknames;
-	std::set<const Client*>::iterator it = _connected.begin();
-	std::set<const Client*>::iterator end = _connected.end();
-
-	std::string prefix;
-
-	while (it != end) {
-		prefix = isOperator(*it) ? "@" : "";
-		nicknames += (prefix + (*it)->getNickname());
-		++it;
-		if (it != end)
-			nicknames += " ";
-	}
-	return nicknames;
-}
 time_t Channel::getCreationTime() const {
 	return _channelTimestamp;
 }
@@ -152,35 +273,24 @@ std::string Channel::getMode() const {
 	return display;
 }
 
-std::set<const Client*> Channel::getClientsList() const {
-	return _connected;
-}
-std::set<const Client*> Channel::getOperatorsList() const {
-	return _operators;
-}
-std::set<const Client*> Channel::getInvitedList() const {
-	return _invited;
-}
 /**
  * @brief Retrieves the file descriptor of a client in the channel by their nickname.
  *
- * This function iterates through the set of connected clients in the channel and
- * checks if the provided nickname matches any client's nickname, excluding the
- * current client. If a match is found, the file descriptor of the matched client
- * is returned.
+ * The nickname is resolved through the server nickname index (O(1), RFC 1459 case
+ * mapping), then the client membership is checked, instead of scanning every member.
+ * The current client is excluded from the search.
  *
  * @param nickname The nickname of the client to search for.
  * @param currClient A pointer to the current client to be excluded from the search.
+ * @param nicknames The server nickname index.
  * @return The file descriptor of the matched client, or -1 if no match is found.
  */
-int Channel::getChannelClientByNickname(const std::string &nickname, const Client* currClient) {
-	for (std::set<const Client*>::iterator it = _connected.begin(); it != _connected.end(); it++) {
-		if (currClient && currClient == *it)
-			continue;
-		if (nickname == (*it)->getNickname()) 
-			return (*it)->getFd();
-	}
-	return -1;
+int Channel::getChannelClientByNickname(const std::string &nickname, const Client* currClient,
+										const NicknameIndex& nicknames) const {
+	const Client* client = nicknames.find(nickname);
+	if (!client || client == currClient || !isConnected(client))
+		return -1;
+	return client->getFd();
 }
 bool Channel::getInvites() const {
 	return _invites;
@@ -197,13 +307,13 @@ int Channel::getNbUser() const {
 
 
 bool Channel::hasClients() const {
-	return !_connected.empty();
+	return _connectedCount != 0;
 }
 bool Channel::hasOperators() const {
-	return !_operators.empty();
+	return _operatorCount != 0;
 }
 bool Channel::hasInvites() const {
-	return !_invited.empty();
+	return _invitedCount != 0;
 }
 bool Channel::hasPassword() const {
 	return !_password.empty();
@@ -216,21 +326,20 @@ bool Channel::isFull() const {
 }
 
 bool Channel::isConnected(const Client* client) const {
-	return _connected.find(client) != _connected.end();
+	return _hasFlag(client, MEMBER);
 }
 bool Channel::isOperator(const Client* client) const {
-	return _operators.find(client) != _operators.end();
+	return _hasFlag(client, OPERATOR);
 }
 bool Channel::isInvited(const Client* client) const {
-	return _invited.find(client) != _invited.end();
+	return _hasFlag(client, INVITED);
 }
 
 
 // === SETTERS / UPDATE CLIENTS LISTS ===
 
 void Channel::addClient(Client* client)  {
-	if (!isConnected(client))
-		_connected.insert(client);
+	_setFlag(client, MEMBER);
 }
 
 /**
@@ -247,11 +356,10 @@ void Channel::addClient(Client* client)  {
  */
 void Channel::addClientToInvitedList(const Client* invited, const Client* inviter)
 {
-	if (!isInvited(invited)) {
-		_invited.insert(invited);
+	if (_setFlag(invited, INVITED)) {
 		inviter->sendMessage(MessageHandler::ircInviting(inviter->getNickname(), invited->getNickname(), _name), NULL);
 		invited->sendMessage(MessageHandler::ircInvitedToChannel(inviter->getNickname(), _name), NULL);
-		std::cout << MessageHandler::msgIsInvitedToChannel(invited->getNickname(), inviter->getNickname(), _name) << std::endl;
+		Logger::info(MessageHandler::msgIsInvitedToChannel(invited->getNickname(), inviter->getNickname(), _name));
 	} else
 		inviter->sendMessage(MessageHandler::ircAlreadyInvitedToChannel(invited->getNickname(), _name), NULL);
 }
@@ -267,9 +375,8 @@ void Channel::addClientToInvitedList(const Client* invited, const Client* invite
  * @param client A pointer to the Client object to be added as an operator.
  */
 void Channel::addOperator(Client* client) {
-	if (!isOperator(client)) {
-		_operators.insert(client);
-		std::cout << MessageHandler::msgClientOperatorAdded(client->getNickname(), _name) << std::endl;
+	if (_setFlag(client, OPERATOR)) {
+		Logger::info(MessageHandler::msgClientOperatorAdded(client->getNickname(), _name));
 		return;
 	}
 	// message is already operator
@@ -285,9 +392,8 @@ void Channel::addOperator(Client* client) {
  * @param client A pointer to the Client object to be removed from the list of operators.
  */
 void Channel::removeOperator(Client* client) {
-	if (isOperator(client)) {
-		_operators.erase(client);
-		std::cout << MessageHandler::msgClientOperatorRemoved(client->getNickname(), _name) << std::endl;
+	if (_clearFlag(client, OPERATOR)) {
+		Logger::info(MessageHandler::msgClientOperatorRemoved(client->getNickname(), _name));
 	}
 }
 
@@ -308,18 +414,17 @@ void Channel::removeClient(Client* client, const Client* kicker, const std::stri
 
 		if (kicker && reasonCode == leaving_code::KICKED) {
 			sendToAll(MessageHandler::ircClientKickUser(kicker->getUsermask(), _name, client->getNickname(), reason), client, true);
-			std::cout << MessageHandler::msgClientKickedFromChannel(client->getNickname(), kicker->getNickname(), _name, reason) << std::endl;
+			Logger::info(MessageHandler::msgClientKickedFromChannel(client->getNickname(), kicker->getNickname(), _name, reason));
 		}
 		if (reasonCode == leaving_code::LEFT) {
 			sendToAll(MessageHandler::ircClientPartChannel(client->getUsermask(), _name, reason), client, true);
 			client->sendMessage(MessageHandler::ircCurrentNotInChannel(client->getNickname(), _name), NULL);
-			std::cout << MessageHandler::msgClientLeftChannel(client->getNickname(), _name, reason) << std::endl;
+			Logger::info(MessageHandler::msgClientLeftChannel(client->getNickname(), _name, reason));
 		}
-		if (reasonCode == leaving_code::QUIT_SERV)
-			sendToAll(MessageHandler::ircClientQuitServer(client->getUsermask(), reason), client, false);
+		// QUIT_SERV : le QUIT a déjà été envoyé une fois à chaque pair (Client::leaveAllChannels)
 
 		// On supprime le client des clients connectes au canal
-		_connected.erase(client);
+		_clearFlag(client, MEMBER);
 		_nbUser--;
 
 		// On l'enleve des operateurs s'il est operateur
@@ -330,9 +435,71 @@ void Channel::removeClient(Client* client, const Client* kicker, const std::stri
 	}
 }
 
+/**
+ * @brief Drops every trace of a client that leaves the server.
+ *
+ * removeClient() only handles the membership: a pending invitation would otherwise
+ * outlive the client, and the next client allocated at the same address (Client pool)
+ * would inherit it.
+ *
+ * @param client The client being deleted.
+ */
+void Channel::forgetClient(const Client* client) {
+	_clearFlag(client, INVITED);
+}
+
 
 // === MESSAGES ===
 
+/**
+ * @brief Sends the NAMES reply of the channel to a client: 353 lines, then 366.
+ *
+ * The nicknames are written straight into the wire buffer while the membership table
+ * is walked (operators prefixed with "@"). A 353 line is closed as soon as the next
+ * nickname would push it past the IRC line limit, and a new one is started with the
+ * same prefix: a large channel gives several complete lines instead of one truncated
+ * line that would also swallow the 366. The whole reply is queued as one buffer.
+ *
+ * @param client The client receiving the list.
+ */
+void Channel::sendNames(const Client* client) const {
+	const std::string& nickname = client->getNickname();
+	const std::string prefix = MessageHandler::ircNameReply(nickname, _name, "");
+
+	std::string wire;
+	wire.reserve(server::BUFFER_SIZE);
+	size_t lineStart = 0;
+	wire += prefix;
+
+	for (MemberIterator it = membersBegin(); it != membersEnd(); ++it) {
+		const std::string& member = it->client->getNickname();
+		bool isOperator = it->flags & OPERATOR;
+		bool hasNames = wire.size() > lineStart + prefix.size();
+		size_t needed = member.size() + isOperator + hasNames;
+
+		// La ligne est pleine : on la termine et on en commence une nouvelle
+		if (hasNames && wire.size() - lineStart + needed > server::BUFFER_SIZE) {
+			wire += eol::IRC;
+			lineStart = wire.size();
+			wire += prefix;
+			hasNames = false;
+		}
+		if (hasNames)
+			wire += ' ';
+		if (isOperator)
+			wire += '@';
+		wire += member;
+	}
+
+	// Pas de 353 vide : seule la fin de liste est envoyée
+	if (wire.size() == lineStart + prefix.size())
+		wire.resize(lineStart);
+	else
+		wire += eol::IRC;
+	wire += MessageHandler::ircFormat(MessageHandler::ircEndOfNames(nickname, _name));
+	client->queueRawMessage(SharedBuffer::adopt(wire));
+}
+
 /**
  * @brief Sends a message to all clients in the channel.
  *
@@ -340,6 +507,8 @@ void Channel::removeClient(Client* client, const Client* kicker, const std::stri
  * to the channel. If the sender is not in the channel, an appropriate error
  * message is sent back to the sender. If the channel is invite-only and the
  * sender is not invited, an invite-only error message is sent back to the sender.
+ * The line is formatted once into a SharedBuffer queued to every member, so the
+ * cost of a broadcast doesn't include one copy per member.
  *
  * @param message The message to be sent to all clients in the channel.
  * @param sender The client sending the message.
@@ -357,9 +526,17 @@ void Channel::sendToAll(const std::string &message, Client* sender, bool include
 		return;
 	}
 
-	for (std::set<const Client*>::iterator it = _connected.begin(); it != _connected.end(); ++it) {
-		if (includeSender == false && *it == sender)
+	// Le message est formaté une seule fois, tous les membres partagent le même buffer
+	std::string wire = MessageHandler::ircFormat(message);
+	SharedBuffer wireMessage = SharedBuffer::adopt(wire);
+	bool sent = false;
+
+	for (MemberIterator it = membersBegin(); it != membersEnd(); ++it) {
+		if (includeSender == false && it->client == sender)
 			continue;
-		(*it)->sendMessage(message, sender);
+		it->client->queueRawMessage(wireMessage);
+		sent = true;
 	}
+	if (sent)
+		Client::notifyLineTooLong(message, sender);
 }
\ No newline at end of file
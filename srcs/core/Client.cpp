@@ -4,17 +4,42 @@
 // === CONSTUCTORS / DESTRUCTORS ===
 
 // --- PUBLIC
-Client::Client(int fd)
-	: _clientSocketFd(fd), _authenticated(false), _rightPassServ(false), _signonTime(time(NULL)), _lastActivity(time(NULL)),
-	_isIrssi(false), _isIdentified(false), _isAway(false), _errorMsgTooLongSent(false), _pingSent(false) {}
+Client::Client(int fd, unsigned long id)
+	: _clientSocketFd(fd), _id(id), _authenticated(false), _rightPassServ(false), _signonTime(time(NULL)), _lastActivity(time(NULL)),
+	_isIrssi(false), _isIdentified(false), _backlogged(false), _isAway(false), _serverOperator(false), _errorMsgTooLongSent(false), _pingSent(false), _leaving(false),
+	_sendQueue(server::SENDQ_MAX), _flushScheduled(false), _waitingWritable(false), _flushList(NULL), _reactorIndex(0), _fanoutMark(0) {}
 Client::~Client() {}
 
 // --- PRIVATE
-Client::Client() {}
-Client::Client(const Client& src) {(void) src;}
+Client::Client() : _sendQueue(server::SENDQ_MAX) {}
+Client::Client(const Client& src) : _sendQueue(server::SENDQ_MAX) {(void) src;}
 Client & Client::operator=(const Client& src) {(void) src; return *this;}
 
 
+// === MEMORY POOL ===
+
+/**
+ * @brief Pool of all the Client objects of the process.
+ *
+ * A function-local static: it exists before the first connection whatever the order
+ * of static initialization, and outlives every client.
+ */
+static ObjectPool<Client, server::CLIENT_POOL_SLAB>& clientPool() {
+	static ObjectPool<Client, server::CLIENT_POOL_SLAB> pool("Client");
+	return pool;
+}
+
+void* Client::operator new(size_t size) {
+	return clientPool().allocate(size);
+}
+void Client::operator delete(void* pointer, size_t size) {
+	clientPool().release(pointer, size);
+}
+PoolUsage Client::poolUsage() {
+	return clientPool().usage();
+}
+
+
 // === SETTERS INFOS CLIENT ===
 
 void Client::setNickname(const std::string &nickname) {
@@ -45,10 +70,10 @@ void Client::setIsIrssi(bool status) {
 void Client::setIdentified(bool status) {
 	_isIdentified = status;
 }
-void Client::setIdentNickCmd(std::vector<std::string> identCmd) {
+void Client::setIdentNickCmd(const std::string& identCmd) {
     _identNicknameCmd = identCmd;
 }
-void Client::setIdentUsernameCmd(std::vector<std::string> identCmd) {
+void Client::setIdentUsernameCmd(const std::string& identCmd) {
     _identUsernameCmd = identCmd;
 }
 void Client::setServPasswordValidity(bool status) {
@@ -73,12 +98,54 @@ void Client::setErrorMsgTooLongSent(bool status) {
 void Client::setPingSent(bool status) {
 	_pingSent = status;
 }
+void Client::setLeaving() {
+	_leaving = true;
+}
+void Client::setServerOperator(bool status) {
+	_serverOperator = status;
+}
 
 
 // === BUFFER ===
 
-std::string& Client::getBufferMessage() {
-	return _bufferMessage;
+InputBuffer& Client::getInputBuffer() {
+	return _inputBuffer;
+}
+
+// Seul le reactor propriétaire lit le socket du client : pas de verrou
+void Client::setBacklogged(bool status) {
+	_backlogged = status;
+}
+bool Client::isBacklogged() const {
+	return _backlogged;
+}
+
+
+// === SEND QUEUE ===
+
+void Client::setReactor(size_t index, FlushList* flushList) {
+	_reactorIndex = index;
+	_flushList = flushList;
+}
+size_t Client::getReactorIndex() const {
+	return _reactorIndex;
+}
+SendQueue::FlushStatus Client::flushSendQueue() {
+	MutexLock lock(_sendLock);
+	_flushScheduled = false;
+	return _sendQueue.flush(_clientSocketFd);
+}
+bool Client::sendQueueOverflowed() const {
+	MutexLock lock(_sendLock);
+	return _sendQueue.overflowed();
+}
+void Client::setWaitingWritable(bool status) {
+	MutexLock lock(_sendLock);
+	_waitingWritable = status;
+}
+bool Client::isWaitingWritable() const {
+	MutexLock lock(_sendLock);
+	return _waitingWritable;
 }
 
 
@@ -87,6 +154,9 @@ std::string& Client::getBufferMessage() {
 int Client::getFd() const {
 	return _clientSocketFd;
 }
+unsigned long Client::getId() const {
+	return _id;
+}
 const std::string& Client::getNickname() const {
 	return _nickname;
 }
@@ -115,10 +185,10 @@ bool Client::isIrssi() const {
 bool Client::isIdentified() const {
     return _isIdentified;
 }
-std::vector<std::string> Client::getIdentNickCmd() const {
+const std::string& Client::getIdentNickCmd() const {
     return _identNicknameCmd;
 }
-std::vector<std::string> Client::getIdentUsernameCmd() const {
+const std::string& Client::getIdentUsernameCmd() const {
     return _identUsernameCmd;
 }
 bool Client::gotValidServPassword() const {
@@ -149,6 +219,12 @@ bool Client::errorMsgTooLongSent() const {
 bool Client::pingSent() const {
 	return _pingSent;
 }
+bool Client::isLeaving() const {
+	return _leaving;
+}
+bool Client::isServerOperator() const {
+	return _serverOperator;
+}
 
 
 // === SEND MESSAGES ===
@@ -166,21 +242,70 @@ bool Client::pingSent() const {
 void Client::sendMessage(const std::string &message, Client* sender) const {
 
 	// On formate le message en IRC (ajout du \r\n, si trop long tronqué à 512 caractères)
-	std::string formatedMessage = MessageHandler::ircFormat(message);
-	if (send(_clientSocketFd, formatedMessage.c_str(), formatedMessage.length(), MSG_NOSIGNAL) == -1) {
-		perror("send() failed");
-		return;
-	}
+	std::string wire = MessageHandler::ircFormat(message);
+	queueRawMessage(SharedBuffer::adopt(wire));
+	notifyLineTooLong(message, sender);
+}
 
-	// Si le message d'origine a été tronqué car trop long, on prévient le sender (cas PRIVMSG).
-	// Si ce même message est envoyé dans un channel ou à plusieurs personnes,
-	// l'erreur ne sera envoyée qu'une seule fois à l'envoyeur grâce à un booléen qu'on set à true
+/**
+ * @brief Warns the sender that its message was truncated.
+ *
+ * Si le message d'origine a été tronqué car trop long, on prévient le sender (cas PRIVMSG).
+ * Si ce même message est envoyé dans un channel ou à plusieurs personnes,
+ * l'erreur ne sera envoyée qu'une seule fois à l'envoyeur grâce à un booléen qu'on set à true
+ *
+ * @param message The original (unformatted) message.
+ * @param sender The client who sent the message, NULL for server messages.
+ */
+void Client::notifyLineTooLong(const std::string &message, Client* sender) {
 	if (message.length() > server::BUFFER_SIZE && sender && sender->errorMsgTooLongSent() == false) {
 		sender->sendMessage(MessageHandler::ircLineTooLong(sender->getNickname()), NULL);
 		sender->setErrorMsgTooLongSent(true);
 	}
 }
 
+/**
+ * @brief Queues an already formatted message for this client.
+ *
+ * The message is not written right away: the client is added once to the server flush
+ * list, and all its pending lines are sent together at the end of the loop iteration.
+ * A single iteration can produce a lot of output (e.g. a flood of PRIVMSG read at once),
+ * so past server::SENDQ_FLUSH_THRESHOLD bytes the queue is written right away instead
+ * of growing until the sendq limit, if the caller is the reactor that owns the socket
+ * (only the owner writes to it; another thread leaves it to the scheduled flush).
+ * While the socket is full the client is not scheduled, the poller will report it as
+ * writable. If the send queue limit is exceeded, the client is scheduled anyway so that
+ * the server can disconnect it.
+ *
+ * In multi-reactor mode the message may come from any thread: the queue is locked, and
+ * the client is pushed into the flush list of the reactor that owns its socket.
+ *
+ * @param wireMessage The message, already ending with \r\n. Only a reference is queued.
+ */
+void Client::queueRawMessage(const SharedBuffer &wireMessage) const {
+
+	MutexLock lock(_sendLock);
+	// File débordée (push refusé) et propriétaire déjà prévenu : rien de plus à faire
+	if (!_sendQueue.push(wireMessage) && _flushScheduled)
+		return;
+
+	// Pas de boucle serveur (ne devrait pas arriver) : envoi immédiat
+	if (!_flushList) {
+		_sendQueue.flush(_clientSocketFd);
+		return;
+	}
+	if (!_flushScheduled && (!_waitingWritable || _sendQueue.overflowed())) {
+		_flushList->push(_clientSocketFd);
+		_flushScheduled = true;
+	}
+
+	// File déjà conséquente : le reactor propriétaire écrit sans attendre la fin de l'itération
+	// (si le socket est plein, le serveur s'abonnera à l'écriture lors de son envoi)
+	if (!_waitingWritable && !_sendQueue.blocked() && _sendQueue.size() >= server::SENDQ_FLUSH_THRESHOLD
+		&& _flushList->ownedByCaller())
+		_sendQueue.flush(_clientSocketFd);
+}
+
 /**
  * @brief Sends a message to all clients in the specified channel.
  *
@@ -195,12 +320,50 @@ void Client::sendToAll(Channel* channel, const std::string &message, bool includ
 	channel->sendToAll(message, this, includeSender);
 }
 
+unsigned long Client::_fanoutGeneration = 0;
+
+/**
+ * @brief Sends a message once to every client sharing at least one channel with this one.
+ *
+ * Used for QUIT and NICK, which concern every peer of the client and not one channel.
+ * Each call has its own generation number: a peer is stamped with it the first time it
+ * is reached, and skipped in the next channels, so a user sharing five channels gets one
+ * line and no temporary set is built. The cost is the sum of the channel sizes, not the
+ * number of clients on the server.
+ * Must be called with the server state locked (the generation counter is shared).
+ *
+ * @param message The message to send.
+ * @param includeSelf Whether the client also gets the message.
+ */
+void Client::sendToPeers(const std::string &message, bool includeSelf) {
+	// Le message est formaté une seule fois, tous les pairs partagent le même buffer
+	std::string wire = MessageHandler::ircFormat(message);
+	SharedBuffer wireMessage = SharedBuffer::adopt(wire);
+	unsigned long generation = ++_fanoutGeneration;
+
+	_fanoutMark = generation;
+	if (includeSelf)
+		queueRawMessage(wireMessage);
+
+	for (std::map<std::string, Channel*>::iterator it = _channelsJoined.begin(); it != _channelsJoined.end(); ++it) {
+		for (Channel::MemberIterator member = it->second->membersBegin(); member != it->second->membersEnd(); ++member) {
+			if (member->client->_fanoutMark == generation)
+				continue;
+			member->client->_fanoutMark = generation;
+			member->client->queueRawMessage(wireMessage);
+		}
+	}
+}
+
 
 // === GETTERS CHANNELS ===
 
 std::map<std::string, Channel*>& Client::getChannelsJoined() {
 	return _channelsJoined;
 }
+const std::vector<std::string>& Client::getInvitedChannels() const {
+	return _invitedChannels;
+}
 bool Client::isInChannel(const std::string& channelName) const {
 	return _channelsJoined.find(channelName) != _channelsJoined.end();
 }
@@ -266,7 +429,7 @@ void Client::createChannel(const std::string& channelName, const std::string& pa
 			}
 			channels[channelName]->setPassword(password);
 		}
-		std::cout << MessageHandler::msgClientCreatedChannel(_nickname, channelName, password) << std::endl;
+		Logger::info(MessageHandler::msgClientCreatedChannel(_nickname, channelName, password));
 		channels[channelName]->addOperator(this);
 		addToChannel(channels[channelName], password, channelName, channels);
 	}
@@ -334,8 +497,8 @@ void Client::msgAfterJoin(Channel* channel, const std::string& channelName) {
 		sendMessage(MessageHandler::ircTopic(_nickname, channel->getName(), channel->getTopic()), NULL);
 		sendMessage(MessageHandler::ircTopicWhoTime(_nickname, channel->getTopicSetterMask(), channel->getName(), channel->getTopicTimestamp()), NULL);
 	}
-	sendMessage(MessageHandler::ircNameReply(_nickname, channelName, channel->getNicknames()), NULL);
-	std::cout << MessageHandler::msgClientJoinedChannel(_nickname, channelName) << std::endl;
+	channel->sendNames(this);
+	Logger::info(MessageHandler::msgClientJoinedChannel(_nickname, channelName));
 }
 
 /**
@@ -403,6 +566,7 @@ void Client::isKickedFromChannel(Channel *channel, Client* kicker, const std::st
  * This function checks if the client is already in the specified channel.
  * If the client is not in the channel, they are added to the channel's invited list.
  * If the client is already in the channel, a message is sent to the inviter indicating that the client is already in the channel.
+ * The channel name is remembered once, so the invitation can be dropped when the client leaves the server.
  * 
  * @param channel Pointer to the Channel object to which the client is being invited.
  * @param inviter Pointer to the Client object who is sending the invitation.
@@ -411,9 +575,11 @@ void Client::isInvitedToChannel(Channel *channel, const Client* inviter)
 {	
 	if (!channel)
 		return;
-	if (!isInChannel(channel->getName()))
+	if (!isInChannel(channel->getName())) {
 		channel->addClientToInvitedList(this, inviter);
-	else
+		if (channel->isInvited(this) && std::find(_invitedChannels.begin(), _invitedChannels.end(), channel->getName()) == _invitedChannels.end())
+			_invitedChannels.push_back(channel->getName());
+	} else
 		inviter->sendMessage(MessageHandler::ircAlreadyOnChannel(inviter->getNickname(), _nickname, channel->getName()), NULL);
 }
 
@@ -438,12 +604,16 @@ void Client::leaveChannel(std::map<std::string, Channel*>::iterator it, std::map
  *
  * This function iterates through all the channels the client has joined and 
  * makes the client leave each one. It uses the leaveChannel function to 
- * handle the process of leaving each channel.
+ * handle the process of leaving each channel. When the client quits the server,
+ * the QUIT is sent first, once to each peer (see sendToPeers()).
  *
  * @param channels A map of channel names to Channel pointers, representing 
  * all available channels.
  */
 void Client::leaveAllChannels(std::map<std::string, Channel*>& channels, const std::string& reason, int reasonCode) {
+	// Un seul QUIT par pair, même s'il partage plusieurs canaux avec le client
+	if (reasonCode == leaving_code::QUIT_SERV)
+		sendToPeers(MessageHandler::ircClientQuitServer(_usermask, reason), false);
 	while (!_channelsJoined.empty())
 		leaveChannel(_channelsJoined.begin(), channels, reason, reasonCode);
 }
@@ -460,8 +630,8 @@ void Client::leaveAllChannels(std::map<std::string, Channel*>& channels, const s
  */
 void Client::deleteChannel(Channel* channel, std::map<std::string, Channel*>& channels) {
 	if (!channel->hasClients()) {
-		std::cout << MessageHandler::msgNoClientInChannel(channel->getName()) << std::endl;
-		std::cout << MessageHandler::msgChannelDestroyed(channel->getName()) << std::endl;
+		Logger::info(MessageHandler::msgNoClientInChannel(channel->getName()));
+		Logger::info(MessageHandler::msgChannelDestroyed(channel->getName()));
 		channels.erase(channel->getName());
 		delete channel;
 	}
@@ -0,0 +1,210 @@
+#include "../../incs/classes/DccOffers.hpp"
+#include "../../incs/classes/NicknameIndex.hpp"
+#include "../../incs/config/irc_config.hpp"
+
+#include <algorithm>			// std::find()
+
+//---------------------------------------------------FILE METHODS---------------------------------------------------//
+
+File::File() {}
+File::File( std::string Name, std::string Path, std::string Sender, std::string Receiver ): Name(Name), Path(Path), sender(Sender), receiver(Receiver) {}
+File::File( const File &x ) { *this = x; }
+File::~File() {}
+File & File::operator=( const File &rhs )
+{
+	if (this == &rhs)
+		return (*this);
+	this->Name = rhs.Name;
+	this->Path = rhs.Path;
+	this->sender = rhs.sender;
+	this->receiver = rhs.receiver;
+	return (*this);
+};
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+// --- PUBLIC
+DccOffers::DccOffers() : _offers(64), _ids(64), _perSender(64), _nextId(0) {}
+DccOffers::~DccOffers() {}
+
+// --- PRIVATE
+DccOffers::DccOffers(const DccOffers& src) {(void) src;}
+DccOffers& DccOffers::operator=(const DccOffers& src) {(void) src; return *this;}
+
+DccOffers::Key::Key(const std::string& sender, const std::string& receiver, const std::string& name)
+	: sender(sender), receiver(receiver), name(name) {}
+
+
+// === HASH / EQUAL ===
+
+// FNV-1a sur les pseudos en minuscules (RFC 1459) puis le nom du fichier, séparés par un octet nul
+size_t DccOffers::KeyHash::operator()(const Key& key) const {
+	size_t hash = 2166136261u;
+	for (size_t i = 0; i < key.sender.size(); ++i)
+		hash = (hash ^ static_cast<unsigned char>(NicknameIndex::casefold(key.sender[i]))) * 16777619u;
+	hash *= 16777619u;
+	for (size_t i = 0; i < key.receiver.size(); ++i)
+		hash = (hash ^ static_cast<unsigned char>(NicknameIndex::casefold(key.receiver[i]))) * 16777619u;
+	hash *= 16777619u;
+	for (size_t i = 0; i < key.name.size(); ++i)
+		hash = (hash ^ static_cast<unsigned char>(key.name[i])) * 16777619u;
+	return hash;
+}
+
+bool DccOffers::KeyEqual::operator()(const Key& a, const Key& b) const {
+	return a.name == b.name && NicknameIndex::equals(a.sender, b.sender) && NicknameIndex::equals(a.receiver, b.receiver);
+}
+
+// Les numéros se suivent : ils se répartissent déjà sur les buckets
+size_t DccOffers::IdHash::operator()(unsigned long id) const {
+	return static_cast<size_t>(id);
+}
+
+bool DccOffers::IdEqual::operator()(unsigned long a, unsigned long b) const {
+	return a == b;
+}
+
+
+// === OFFERS ===
+
+/**
+ * @brief Registers an offer, or replaces the same one (new serial number, new expiry).
+ *
+ * @param file The offered file (name, path, sender and receiver nicknames).
+ * @param senderId The connection number of the sender, counted for its quota.
+ * @return unsigned long The serial number of the offer, to schedule its expiry.
+ *         0 if the sender already has server::DCC_OFFERS_PER_USER offers pending.
+ */
+unsigned long DccOffers::add(const File& file, unsigned long senderId) {
+
+	Key key(file.sender, file.receiver, file.Name);
+	DccOffer* previous = _offers.find(key);
+	std::vector<unsigned long>* ids = _perSender.find(senderId);
+
+	// Remplacer sa propre offre ne compte pas dans le quota
+	if (!(previous && previous->senderId == senderId) && ids && ids->size() >= server::DCC_OFFERS_PER_USER)
+		return 0;
+	if (previous)
+		_erase(key, *previous);
+
+	DccOffer offer;
+	offer.file = file;
+	offer.id = ++_nextId;
+	offer.senderId = senderId;
+	offer.resumePosition = -1;
+	offer.startOffset = 0;
+	offer.copying = false;
+	_offers.insert(key, offer);
+	_ids.insert(offer.id, key);
+
+	ids = _perSender.find(senderId);
+	if (!ids) {
+		_perSender.insert(senderId, std::vector<unsigned long>());
+		ids = _perSender.find(senderId);
+	}
+	ids->push_back(offer.id);
+	return offer.id;
+}
+
+// L'offre est modifiée sur place (RESUME, ACCEPT, début de copie)
+DccOffer* DccOffers::find(const std::string& sender, const std::string& receiver, const std::string& name) {
+	return _offers.find(Key(sender, receiver, name));
+}
+
+/**
+ * @brief Drops an offer whose timer fired.
+ *
+ * An offer being copied is kept: it is dropped when its copy ends.
+ *
+ * @param id The serial number given by add().
+ * @return bool True if the offer is kept (copy in progress): its timer must be scheduled again.
+ */
+bool DccOffers::expire(unsigned long id) {
+	Key* key;
+	DccOffer* offer = _findById(id, key);
+	if (!offer)
+		return false;
+	if (offer->copying)
+		return true;
+	_erase(Key(*key), *offer);
+	return false;
+}
+
+/**
+ * @brief Ends the copy of an offer.
+ *
+ * A complete copy consumes the offer. After a failure it stays available, at the same
+ * entry: the receiver may resume the copy where it stopped (DCC RESUME / ACCEPT).
+ *
+ * @param id The serial number of the copied offer.
+ * @param done True if the whole file was copied.
+ */
+void DccOffers::copyEnded(unsigned long id, bool done) {
+	Key* key;
+	DccOffer* offer = _findById(id, key);
+	if (!offer)
+		return;
+	if (done) {
+		_erase(Key(*key), *offer);
+		return;
+	}
+	offer->copying = false;
+	offer->startOffset = 0;
+}
+
+/**
+ * @brief Drops every offer of a connection that is being closed.
+ *
+ * A copy still running keeps its FileTransfer: copyEnded() then finds no offer and
+ * does nothing.
+ *
+ * @param senderId The connection number of the leaving client.
+ */
+void DccOffers::removeSender(unsigned long senderId) {
+	std::vector<unsigned long>* ids = _perSender.find(senderId);
+	if (!ids)
+		return;
+	// _erase() retire les numéros de la liste : on parcourt une copie
+	std::vector<unsigned long> pending(*ids);
+	for (size_t i = 0; i < pending.size(); ++i) {
+		Key* key;
+		DccOffer* offer = _findById(pending[i], key);
+		if (offer)
+			_erase(Key(*key), *offer);
+	}
+	_perSender.erase(senderId);
+}
+
+size_t DccOffers::size() const {
+	return _offers.size();
+}
+
+// Une offre remplacée depuis (même clé, nouveau numéro) n'est pas celle recherchée
+DccOffer* DccOffers::_findById(unsigned long id, Key*& key) {
+	key = _ids.find(id);
+	if (!key)
+		return NULL;
+	DccOffer* offer = _offers.find(*key);
+	if (!offer || offer->id != id)
+		return NULL;
+	return offer;
+}
+
+// Les champs utiles sont copiés avant d'effacer : `offer` pointe dans la table (et `key` peut-être aussi)
+void DccOffers::_erase(const Key& key, const DccOffer& offer) {
+	unsigned long id = offer.id;
+	unsigned long senderId = offer.senderId;
+
+	std::vector<unsigned long>* ids = _perSender.find(senderId);
+	if (ids) {
+		// Au plus server::DCC_OFFERS_PER_USER numéros
+		std::vector<unsigned long>::iterator it = std::find(ids->begin(), ids->end(), id);
+		if (it != ids->end())
+			ids->erase(it);
+		if (ids->empty())
+			_perSender.erase(senderId);
+	}
+	_ids.erase(id);
+	_offers.erase(key);
+}
@@ -0,0 +1,204 @@
+#include "../../incs/classes/FileTransfer.hpp"
+#include "../../incs/classes/CommandStats.hpp"
+#include "../../incs/config/irc_config.hpp"
+
+#include <unistd.h>				// read(), write(), close(), ftruncate()
+#include <fcntl.h>				// open() -> O_RDONLY, O_WRONLY, O_CREAT
+#include <sys/stat.h>			// fstat()
+#include <cerrno>				// errno
+#ifdef __linux__
+# include <sys/sendfile.h>		// sendfile()
+#endif
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+// --- PUBLIC
+FileTransfer::FileTransfer(const std::string& name, const std::string& sender, int senderFd, unsigned long senderId,
+	const std::string& receiver, int receiverFd, unsigned long receiverId, unsigned long offerId)
+	: _sourceFd(-1), _destFd(-1), _offset(0), _size(0), _startOffset(0), _started(0), _copied(0),
+	_sourceDevice(0), _sourceInode(0), _destDevice(0), _destInode(0), _truncated(false), name(name), sender(sender),
+	receiver(receiver), senderFd(senderFd), senderId(senderId), receiverFd(receiverFd), receiverId(receiverId), offerId(offerId),
+	bandwidth(server::DCC_TRANSFER_RATE, server::DCC_CHUNK_SIZE), pending(false), status(IN_PROGRESS) {}
+
+FileTransfer::~FileTransfer() {
+	_close();
+}
+
+// --- PRIVATE
+FileTransfer::FileTransfer() : bandwidth(0, 0) {}
+FileTransfer::FileTransfer(const FileTransfer& src) : bandwidth(0, 0) {(void) src;}
+FileTransfer& FileTransfer::operator=(const FileTransfer& src) {(void) src; return *this;}
+
+void FileTransfer::_close() {
+	if (_sourceFd >= 0)
+		close(_sourceFd);
+	if (_destFd >= 0)
+		close(_destFd);
+	_sourceFd = -1;
+	_destFd = -1;
+}
+
+
+// === COPY ===
+
+/**
+ * @brief Opens the offered file and its copy, ready to copy from `offset`.
+ *
+ * The copy is created if needed and will be cut at `offset` by the first advance():
+ * the bytes before it are kept, the ones after are written again. Nothing is cut
+ * before the server checked that no other copy uses these files (sharesFile()).
+ * Copying a file onto itself is refused (it would be emptied before being read), and
+ * so is a copy shorter than `offset` (the hole would be filled with zeros).
+ *
+ * @param sourcePath The path of the offered file.
+ * @param destPath The path of the copy.
+ * @param offset The number of bytes the copy already has (0 for a new copy).
+ * @return bool False if a file can't be opened, if both paths are the same file or if
+ *         the copy has less than `offset` bytes.
+ */
+bool FileTransfer::open(const std::string& sourcePath, const std::string& destPath, off_t offset) {
+
+	struct stat source;
+	struct stat dest;
+
+	_sourceFd = ::open(sourcePath.c_str(), O_RDONLY);
+	if (_sourceFd < 0 || fstat(_sourceFd, &source) < 0 || !S_ISREG(source.st_mode)) {
+		_close();
+		return false;
+	}
+	_destFd = ::open(destPath.c_str(), O_WRONLY | O_CREAT, 0644);
+	if (_destFd < 0 || fstat(_destFd, &dest) < 0
+		|| (source.st_dev == dest.st_dev && source.st_ino == dest.st_ino) || dest.st_size < offset) {
+		_close();
+		return false;
+	}
+
+	_sourceDevice = source.st_dev;
+	_sourceInode = source.st_ino;
+	_destDevice = dest.st_dev;
+	_destInode = dest.st_ino;
+	_size = source.st_size;
+	_offset = offset < _size ? offset : _size;
+	if (lseek(_destFd, _offset, SEEK_SET) < 0) {
+		_close();
+		return false;
+	}
+	_startOffset = _offset;
+	_started = CommandStats::now();
+	return true;
+}
+
+/**
+ * @brief Copies the next chunk of the file.
+ *
+ * sendfile() reads the source at the session offset and writes to the current position
+ * of the copy, inside the kernel. Elsewhere the chunk goes through a small stack buffer.
+ * A source that got shorter in the meantime ends the copy where it stops.
+ * The first chunk cuts the copy at its starting position (see open()).
+ *
+ * @param chunk The maximum number of bytes to copy.
+ * @return Status DONE once the whole file is copied, FAILED on a read or write error.
+ */
+FileTransfer::Status FileTransfer::advance(size_t chunk) {
+
+	if (_sourceFd < 0 || _destFd < 0)
+		return FAILED;
+	if (!_truncated) {
+		if (ftruncate(_destFd, _offset) < 0) {
+			_close();
+			return FAILED;
+		}
+		_truncated = true;
+	}
+	if (_offset >= _size) {
+		_close();
+		return DONE;
+	}
+
+	off_t left = _size - _offset;
+	size_t count = static_cast<off_t>(chunk) < left ? chunk : static_cast<size_t>(left);
+
+#ifdef __linux__
+	ssize_t copied = sendfile(_destFd, _sourceFd, &_offset, count);
+#else
+	char buffer[65536];
+	if (count > sizeof(buffer))
+		count = sizeof(buffer);
+	ssize_t copied = pread(_sourceFd, buffer, count, _offset);
+	if (copied > 0) {
+		copied = write(_destFd, buffer, copied);
+		if (copied > 0)
+			_offset += copied;
+	}
+#endif
+	if (copied > 0)
+		__atomic_store_n(&_copied, static_cast<unsigned long>(_offset - _startOffset), __ATOMIC_RELAXED);
+
+	if (copied < 0) {
+		if (errno == EINTR || errno == EAGAIN)
+			return IN_PROGRESS;
+		_close();
+		return FAILED;
+	}
+	if (copied == 0 || _offset >= _size) {
+		_close();
+		return DONE;
+	}
+	return IN_PROGRESS;
+}
+
+off_t FileTransfer::offset() const {
+	return _offset;
+}
+off_t FileTransfer::size() const {
+	return _size;
+}
+
+unsigned long FileTransfer::copied() const {
+	return __atomic_load_n(&_copied, __ATOMIC_RELAXED);
+}
+
+// Débit moyen depuis l'ouverture, pauses de limitation comprises
+unsigned long FileTransfer::throughput(unsigned long now) const {
+	if (now <= _started)
+		return 0;
+	return static_cast<unsigned long>(static_cast<double>(copied()) * 1000000.0 / static_cast<double>(now - _started));
+}
+
+/**
+ * @brief Tells whether two opened copies can't run together.
+ *
+ * A file may be read by several copies, but a file being written must not be read
+ * or written by another one. Files are compared by (st_dev, st_ino): two paths may
+ * name the same file (links, "." or "..").
+ */
+bool FileTransfer::sharesFile(const FileTransfer& other) const {
+	bool writesOther = _destDevice == other._destDevice && _destInode == other._destInode;
+	bool writesSource = _destDevice == other._sourceDevice && _destInode == other._sourceInode;
+	bool readsDest = _sourceDevice == other._destDevice && _sourceInode == other._destInode;
+	return writesOther || writesSource || readsDest;
+}
+
+
+// =========================================================================================
+// === COPY CHUNK JOB ===
+
+// --- PUBLIC
+CopyChunkJob::CopyChunkJob(FileTransfer* transfer, size_t chunk)
+	: _transfer(transfer), _chunk(chunk), _status(FileTransfer::IN_PROGRESS) {}
+CopyChunkJob::~CopyChunkJob() {}
+
+// --- PRIVATE
+CopyChunkJob::CopyChunkJob() {}
+
+void CopyChunkJob::run() {
+	_status = _transfer->advance(_chunk);
+}
+
+// La copie redevient disponible pour le reactor, qui la termine si besoin (Server::_runTransfers())
+void CopyChunkJob::complete(Server& server) {
+	(void) server;
+	_transfer->status = _status;
+	_transfer->pending = false;
+}
@@ -0,0 +1,67 @@
+#include "../../incs/classes/FlushList.hpp"
+
+#include <unistd.h>				// write()
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+// --- PUBLIC
+FlushList::FlushList() : _wakeFd(-1), _owner(), _hasOwner(false) {}
+FlushList::~FlushList() {}
+
+// --- PRIVATE
+FlushList::FlushList(const FlushList& src) {(void) src;}
+FlushList& FlushList::operator=(const FlushList& src) {(void) src; return *this;}
+
+
+// === METHODS ===
+
+/**
+ * @brief Makes the calling thread the owner of the list.
+ *
+ * @param wakeFd Write end of the pipe watched by the owner's poller.
+ */
+void FlushList::setOwner(int wakeFd) {
+	MutexLock lock(_lock);
+	_wakeFd = wakeFd;
+	_owner = pthread_self();
+	_hasOwner = true;
+}
+
+/**
+ * @brief Schedules a client for a flush.
+ *
+ * The owner flushes its list at the end of every loop iteration, so it never needs
+ * to be woken up. Another thread only wakes it up on the first push of a batch:
+ * the following ones will be taken by the same flush.
+ *
+ * @param fd The client socket.
+ */
+void FlushList::push(int fd) {
+	MutexLock lock(_lock);
+	bool wasEmpty = _fds.empty();
+	_fds.push_back(fd);
+
+	if (wasEmpty && _wakeFd >= 0 && _hasOwner && !pthread_equal(_owner, pthread_self())) {
+		// Pipe plein : le propriétaire a déjà un réveil en attente
+		if (write(_wakeFd, "!", 1) < 0) {}
+	}
+}
+
+/**
+ * @brief Takes the pending clients, the list is left empty.
+ *
+ * @param fds Cleared then filled with the scheduled fds.
+ * @return bool False if nothing was scheduled.
+ */
+bool FlushList::take(std::vector<int>& fds) {
+	fds.clear();
+	MutexLock lock(_lock);
+	_fds.swap(fds);
+	return !fds.empty();
+}
+
+bool FlushList::ownedByCaller() {
+	MutexLock lock(_lock);
+	return _hasOwner && pthread_equal(_owner, pthread_self());
+}
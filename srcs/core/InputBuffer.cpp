@@ -0,0 +1,164 @@
+#include "../../incs/classes/InputBuffer.hpp"
+
+#include <cstring>				// memchr(), memmove(), memcpy()
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+// --- PUBLIC
+InputBuffer::InputBuffer()
+	: _data(NULL), _capacity(0), _start(0), _scan(0), _end(0), _readSize(server::INPUT_READ_MIN) {}
+InputBuffer::~InputBuffer() {
+	delete[] _data;
+}
+
+// --- PRIVATE
+InputBuffer::InputBuffer(const InputBuffer& src) {(void) src;}
+InputBuffer& InputBuffer::operator=(const InputBuffer& src) {(void) src; return *this;}
+
+
+// === MEMORY ===
+
+/**
+ * @brief Makes sure at least `needed` bytes are free at the end of the buffer.
+ *
+ * First the partial line is moved back to the front (it is the only data still alive),
+ * then, if that is not enough, the buffer grows.
+ *
+ * @param needed The number of free bytes required after _end.
+ */
+void InputBuffer::_reserve(size_t needed) {
+
+	if (_capacity - _end >= needed)
+		return;
+
+	size_t used = _end - _start;
+
+	// On récupère la place des lignes déjà traitées
+	if (_start > 0 && _capacity - used >= needed) {
+		std::memmove(_data, _data + _start, used);
+		_scan -= _start;
+		_end = used;
+		_start = 0;
+		return;
+	}
+
+	// Pas assez de place : on agrandit
+	size_t newCapacity = _capacity ? _capacity * 2 : needed;
+	while (newCapacity - used < needed)
+		newCapacity *= 2;
+
+	char* newData = new char[newCapacity];
+	if (used)
+		std::memcpy(newData, _data + _start, used);
+	delete[] _data;
+	_data = newData;
+	_capacity = newCapacity;
+	_scan -= _start;
+	_end = used;
+	_start = 0;
+}
+
+
+// === READ ===
+
+/**
+ * @brief Returns where recv() must write and how many bytes it may write.
+ *
+ * @param available Set to the number of bytes free at the returned address.
+ * @return char* The end of the received data.
+ */
+char* InputBuffer::prepareWrite(size_t& available) {
+	_reserve(_readSize);
+	available = _capacity - _end;
+	return _data + _end;
+}
+
+/**
+ * @brief Validates the bytes written by recv() and adapts the next read size.
+ *
+ * @param written The number of bytes recv() returned.
+ */
+void InputBuffer::commitWrite(size_t written) {
+	_end += written;
+
+	// Lecture pleine : le client envoie beaucoup, on lira plus la prochaine fois
+	if (written >= _readSize && _readSize < server::INPUT_READ_MAX)
+		_readSize *= 2;
+	// Petites lectures : on revient progressivement à une taille raisonnable
+	else if (written < _readSize / 4 && _readSize > server::INPUT_READ_MIN)
+		_readSize /= 2;
+}
+
+
+// === LINES ===
+
+/**
+ * @brief Extracts the next complete line.
+ *
+ * The view points inside the buffer and stays valid until the next prepareWrite() call.
+ * The trailing \n (and \r if any, cas irssi) is not part of the line.
+ *
+ * @param line Set to the first byte of the line.
+ * @param length Set to the length of the line.
+ * @return true if a complete line was found, false if only a partial line is left.
+ */
+bool InputBuffer::nextLine(const char*& line, size_t& length) {
+
+	if (_scan == _end)
+		return false;
+
+	// On ne recherche le \n que dans les octets pas encore parcourus
+	const char* newline = static_cast<const char*>(std::memchr(_data + _scan, '\n', _end - _scan));
+	if (!newline) {
+		_scan = _end;
+		return false;
+	}
+
+	line = _data + _start;
+	length = newline - line;
+	if (length > 0 && line[length - 1] == '\r')
+		length--;
+
+	_start = _scan = (newline - _data) + 1;
+
+	// Tout a été consommé : on repart du début du buffer (sans toucher aux octets de la vue)
+	if (_start == _end)
+		_start = _scan = _end = 0;
+	return true;
+}
+
+/**
+ * @brief Shows the next complete line without consuming it.
+ *
+ * Lets the caller decide whether the line is handled now (nextLine() then returns the
+ * same view at no cost: the scan stops on its '\n') or left in the buffer for later.
+ *
+ * @param line Set to the first byte of the line.
+ * @param length Set to the length of the line.
+ * @return true if a complete line is buffered, false if only a partial line is left.
+ */
+bool InputBuffer::peekLine(const char*& line, size_t& length) {
+	if (_scan == _end)
+		return false;
+	const char* newline = static_cast<const char*>(std::memchr(_data + _scan, '\n', _end - _scan));
+	if (!newline) {
+		_scan = _end;
+		return false;
+	}
+	// Les octets avant le \n sont déjà parcourus : nextLine() le trouve immédiatement
+	_scan = newline - _data;
+	line = _data + _start;
+	length = newline - line;
+	if (length > 0 && line[length - 1] == '\r')
+		length--;
+	return true;
+}
+
+size_t InputBuffer::pending() const {
+	return _end - _start;
+}
+
+void InputBuffer::clear() {
+	_start = _scan = _end = 0;
+}
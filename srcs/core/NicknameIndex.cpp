@@ -0,0 +1,77 @@
+#include "../../incs/classes/NicknameIndex.hpp"
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+// --- PUBLIC
+NicknameIndex::NicknameIndex() : _clients(1024) {}
+NicknameIndex::~NicknameIndex() {}
+
+// --- PRIVATE
+NicknameIndex::NicknameIndex(const NicknameIndex& src) {(void) src;}
+NicknameIndex& NicknameIndex::operator=(const NicknameIndex& src) {(void) src; return *this;}
+
+
+// === CASE MAPPING (RFC 1459) ===
+
+char NicknameIndex::casefold(char c) {
+	if (c >= 'A' && c <= 'Z')
+		return c + ('a' - 'A');
+	// []\~ sont les majuscules de {}|^
+	switch (c) {
+		case '[': return '{';
+		case ']': return '}';
+		case '\\': return '|';
+		case '~': return '^';
+		default: return c;
+	}
+}
+
+bool NicknameIndex::equals(const std::string& a, const std::string& b) {
+	if (a.size() != b.size())
+		return false;
+	for (size_t i = 0; i < a.size(); ++i)
+		if (casefold(a[i]) != casefold(b[i]))
+			return false;
+	return true;
+}
+
+// FNV-1a sur les caractères en minuscules
+size_t NicknameIndex::Hash::operator()(const std::string& nickname) const {
+	size_t hash = 2166136261u;
+	for (size_t i = 0; i < nickname.size(); ++i) {
+		hash ^= static_cast<unsigned char>(casefold(nickname[i]));
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+bool NicknameIndex::Equal::operator()(const std::string& a, const std::string& b) const {
+	return NicknameIndex::equals(a, b);
+}
+
+
+// === INDEX ===
+
+Client* NicknameIndex::find(const std::string& nickname) const {
+	Client* const* client = _clients.find(nickname);
+	return client ? *client : NULL;
+}
+
+bool NicknameIndex::add(const std::string& nickname, Client* client) {
+	if (nickname.empty())
+		return false;
+	return _clients.insert(nickname, client);
+}
+
+void NicknameIndex::remove(const std::string& nickname, const Client* client) {
+	if (nickname.empty())
+		return;
+	// On ne retire que l'entrée du client lui-même
+	if (find(nickname) == client)
+		_clients.erase(nickname);
+}
+
+size_t NicknameIndex::size() const {
+	return _clients.size();
+}
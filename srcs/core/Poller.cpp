@@ -0,0 +1,29 @@
+#include "../../incs/classes/Poller.hpp"
+
+// =========================================================================================
+
+// --- PROTECTED
+Poller::Poller() {}
+
+// --- PRIVATE
+Poller::Poller(const Poller& src) {(void) src;}
+Poller& Poller::operator=(const Poller& src) {(void) src; return *this;}
+
+// --- PUBLIC
+Poller::~Poller() {}
+
+/**
+ * @brief Creates the event loop backend for this platform.
+ *
+ * epoll is used on Linux, select() everywhere else. Building with
+ * `make POLLER=select` forces the select() backend on Linux too.
+ *
+ * @return Poller* A heap allocated backend, owned by the caller.
+ */
+Poller* Poller::create() {
+#if defined(__linux__) && !defined(USE_SELECT_POLLER)
+	return new EpollPoller();
+#else
+	return new SelectPoller();
+#endif
+}
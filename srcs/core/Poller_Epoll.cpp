@@ -0,0 +1,109 @@
+#include "../../incs/classes/Poller.hpp"
+
+#ifdef __linux__
+
+#include <unistd.h>				// close()
+#include <cerrno>				// errno
+#include <stdexcept>			// std::runtime_error
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+// --- PUBLIC
+EpollPoller::EpollPoller() : _epollFd(-1), _events(server::POLL_MAX_EVENTS) {
+	_epollFd = epoll_create(server::POLL_MAX_EVENTS);
+	if (_epollFd < 0)
+		throw std::runtime_error("Failed to create epoll instance");
+}
+EpollPoller::~EpollPoller() {
+	if (_epollFd >= 0)
+		close(_epollFd);
+}
+
+// --- PRIVATE
+EpollPoller::EpollPoller(const EpollPoller& src) : Poller() {(void) src;}
+EpollPoller& EpollPoller::operator=(const EpollPoller& src) {(void) src; return *this;}
+
+
+// === CONVERSIONS ===
+
+unsigned int EpollPoller::_toEpoll(int events) {
+	// Toujours en edge-triggered : l'appelant lit/écrit jusqu'à EAGAIN
+	unsigned int res = EPOLLET | EPOLLRDHUP;
+	if (events & poll_event::READ)
+		res |= EPOLLIN;
+	if (events & poll_event::WRITE)
+		res |= EPOLLOUT;
+	return res;
+}
+
+int EpollPoller::_fromEpoll(unsigned int events) {
+	int res = 0;
+	// Une déconnexion (HUP/RDHUP) est remontée comme une lecture : recv() renverra 0
+	if (events & (EPOLLIN | EPOLLHUP | EPOLLRDHUP))
+		res |= poll_event::READ;
+	if (events & EPOLLOUT)
+		res |= poll_event::WRITE;
+	if (events & EPOLLERR)
+		res |= poll_event::ERROR | poll_event::READ;
+	return res;
+}
+
+
+// === REGISTRATION ===
+
+bool EpollPoller::add(int fd, int events) {
+	struct epoll_event ev;
+	ev.events = _toEpoll(events);
+	ev.data.fd = fd;
+	return epoll_ctl(_epollFd, EPOLL_CTL_ADD, fd, &ev) == 0;
+}
+
+bool EpollPoller::modify(int fd, int events) {
+	struct epoll_event ev;
+	ev.events = _toEpoll(events);
+	ev.data.fd = fd;
+	return epoll_ctl(_epollFd, EPOLL_CTL_MOD, fd, &ev) == 0;
+}
+
+void EpollPoller::remove(int fd) {
+	// Un event non NULL est requis par les noyaux < 2.6.9
+	struct epoll_event ev;
+	ev.events = 0;
+	ev.data.fd = fd;
+	epoll_ctl(_epollFd, EPOLL_CTL_DEL, fd, &ev);
+}
+
+
+// === WAIT ===
+
+/**
+ * @brief Waits for ready descriptors.
+ *
+ * Only the descriptors reported by the kernel are copied into `ready`,
+ * so the cost does not depend on how many sockets are registered.
+ *
+ * @param ready Filled with the ready descriptors (cleared first).
+ * @param timeoutMs Maximum wait in milliseconds (-1 = infinite).
+ * @return int The number of ready descriptors, 0 on timeout/EINTR, -1 on error.
+ */
+int EpollPoller::wait(std::vector<PollEvent>& ready, int timeoutMs) {
+	ready.clear();
+	int n = epoll_wait(_epollFd, &_events[0], static_cast<int>(_events.size()), timeoutMs);
+	if (n < 0)
+		return errno == EINTR ? 0 : -1;
+
+	for (int i = 0; i < n; ++i) {
+		PollEvent ev;
+		ev.fd = _events[i].data.fd;
+		ev.events = _fromEpoll(_events[i].events);
+		ready.push_back(ev);
+	}
+	return n;
+}
+
+const char* EpollPoller::name() const {
+	return "epoll";
+}
+
+#endif
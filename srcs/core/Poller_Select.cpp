@@ -0,0 +1,116 @@
+#include "../../incs/classes/Poller.hpp"
+
+#include <cerrno>				// errno
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+// --- PUBLIC
+SelectPoller::SelectPoller() {
+	// FD_ZERO initialise les ensembles à zéro pour s'assurer qu'ils sont vides
+	// avant d'y ajouter de nouveaux descripteurs
+	FD_ZERO(&_readFds);
+	FD_ZERO(&_writeFds);
+}
+SelectPoller::~SelectPoller() {
+	FD_ZERO(&_readFds);
+	FD_ZERO(&_writeFds);
+}
+
+// --- PRIVATE
+SelectPoller::SelectPoller(const SelectPoller& src) : Poller() {(void) src;}
+SelectPoller& SelectPoller::operator=(const SelectPoller& src) {(void) src; return *this;}
+
+/**
+ * @brief Get the maximum file descriptor currently registered.
+ *
+ * The registered descriptors are kept in a sorted set,
+ * so the maximum is simply the last element.
+ *
+ * @return int The maximum registered file descriptor, or -1 if none.
+ */
+int SelectPoller::_getMaxFd() const {
+	if (_fds.empty())
+		return -1;
+	return *_fds.rbegin();
+}
+
+
+// === REGISTRATION ===
+
+bool SelectPoller::add(int fd, int events) {
+	// select() ne peut pas surveiller de descripteur au-delà de FD_SETSIZE (1024)
+	if (fd < 0 || fd >= FD_SETSIZE)
+		return false;
+	_fds.insert(fd);
+	return modify(fd, events);
+}
+
+bool SelectPoller::modify(int fd, int events) {
+	if (_fds.find(fd) == _fds.end())
+		return false;
+	if (events & poll_event::READ)
+		FD_SET(fd, &_readFds);
+	else
+		FD_CLR(fd, &_readFds);
+	if (events & poll_event::WRITE)
+		FD_SET(fd, &_writeFds);
+	else
+		FD_CLR(fd, &_writeFds);
+	return true;
+}
+
+void SelectPoller::remove(int fd) {
+	if (_fds.erase(fd) == 0)
+		return;
+	FD_CLR(fd, &_readFds);
+	FD_CLR(fd, &_writeFds);
+}
+
+
+// === WAIT ===
+
+/**
+ * @brief Waits for ready descriptors with select().
+ *
+ * select() modifies the sets it receives, so a temporary copy is made at each call.
+ *
+ * @param ready Filled with the ready descriptors (cleared first).
+ * @param timeoutMs Maximum wait in milliseconds (-1 = infinite).
+ * @return int The number of ready descriptors, 0 on timeout/EINTR, -1 on error.
+ */
+int SelectPoller::wait(std::vector<PollEvent>& ready, int timeoutMs) {
+	ready.clear();
+
+	fd_set readFds = _readFds;
+	fd_set writeFds = _writeFds;
+
+	struct timeval timeout;
+	struct timeval* timeoutPtr = NULL;
+	if (timeoutMs >= 0) {
+		timeout.tv_sec = timeoutMs / 1000;
+		timeout.tv_usec = (timeoutMs % 1000) * 1000;
+		timeoutPtr = &timeout;
+	}
+
+	int n = select(_getMaxFd() + 1, &readFds, &writeFds, NULL, timeoutPtr);
+	if (n < 0)
+		return errno == EINTR ? 0 : -1;
+
+	for (std::set<int>::const_iterator it = _fds.begin(); it != _fds.end() && static_cast<int>(ready.size()) < n; ++it) {
+		PollEvent ev;
+		ev.fd = *it;
+		ev.events = 0;
+		if (FD_ISSET(*it, &readFds))
+			ev.events |= poll_event::READ;
+		if (FD_ISSET(*it, &writeFds))
+			ev.events |= poll_event::WRITE;
+		if (ev.events)
+			ready.push_back(ev);
+	}
+	return static_cast<int>(ready.size());
+}
+
+const char* SelectPoller::name() const {
+	return "select";
+}
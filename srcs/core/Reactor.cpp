@@ -0,0 +1,86 @@
+#include "../../incs/classes/Reactor.hpp"
+#include "../../incs/config/server_messages.hpp"
+
+#include <unistd.h>				// pipe(), read(), write(), close()
+#include <fcntl.h>				// fcntl() -> F_SETFL, O_NONBLOCK
+#include <stdexcept>			// std::runtime_error
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+// --- PUBLIC
+
+/**
+ * @brief Creates the poller and the wakeup pipe of a reactor.
+ *
+ * The listening socket is set up by the server, which knows whether it can be
+ * shared (SO_REUSEPORT) or not. The flush list gets its owner when the thread starts.
+ *
+ * @throws std::runtime_error If the poller or the pipe can't be created.
+ */
+Reactor::Reactor(size_t index, Server* server)
+	: index(index), server(server), thread(), threadStarted(false),
+	poller(NULL), listenFd(-1), ownsListener(false), transferCursor(0), transferDelay(0), _stop(0) {
+
+	wakePipe[0] = -1;
+	wakePipe[1] = -1;
+
+	poller = Poller::create();
+	if (pipe(wakePipe) < 0
+		|| fcntl(wakePipe[0], F_SETFL, O_NONBLOCK) < 0 || fcntl(wakePipe[1], F_SETFL, O_NONBLOCK) < 0
+		|| !poller->add(wakePipe[0], poll_event::READ)) {
+		_release();
+		throw std::runtime_error(server_messages::ERR_WAKEUP_PIPE);
+	}
+	completions.setWakeFd(wakePipe[1]);
+}
+
+Reactor::~Reactor() {
+	_release();
+}
+
+// --- PRIVATE
+Reactor::Reactor() {}
+Reactor::Reactor(const Reactor& src) {(void) src;}
+Reactor& Reactor::operator=(const Reactor& src) {(void) src; return *this;}
+
+void Reactor::_release() {
+	completions.setWakeFd(-1);
+	for (size_t i = 0; i < transfers.size(); ++i)
+		delete transfers[i];
+	transfers.clear();
+	for (int i = 0; i < 2; ++i) {
+		if (wakePipe[i] >= 0)
+			close(wakePipe[i]);
+		wakePipe[i] = -1;
+	}
+	if (ownsListener && listenFd >= 0)
+		close(listenFd);
+	listenFd = -1;
+	delete poller;
+	poller = NULL;
+}
+
+
+// === WAKEUP ===
+
+void Reactor::drainWakePipe() {
+	char buffer[64];
+	while (read(wakePipe[0], buffer, sizeof(buffer)) > 0) {}
+}
+
+void Reactor::wake() {
+	if (wakePipe[1] >= 0 && write(wakePipe[1], "!", 1) < 0) {}
+}
+
+
+// === STOP ===
+
+void Reactor::requestStop() {
+	__atomic_store_n(&_stop, 1, __ATOMIC_RELEASE);
+	wake();
+}
+
+bool Reactor::stopRequested() {
+	return __atomic_load_n(&_stop, __ATOMIC_ACQUIRE) != 0;
+}
@@ -0,0 +1,78 @@
+#include "../../incs/classes/RegistrationBurst.hpp"
+#include "../../incs/classes/MessageHandler.hpp"
+
+// =========================================================================================
+
+// Marqueurs des champs variables dans les lignes formatées (jamais présents dans un pseudo)
+static const char NICKNAME_MARK = '\x01';
+static const char USERMASK_MARK = '\x02';
+
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+// --- PUBLIC
+RegistrationBurst::RegistrationBurst() : _staticSize(0) {}
+RegistrationBurst::~RegistrationBurst() {}
+
+// --- PRIVATE
+RegistrationBurst::RegistrationBurst(const RegistrationBurst& src) {(void) src;}
+RegistrationBurst& RegistrationBurst::operator=(const RegistrationBurst& src) {(void) src; return *this;}
+
+
+// === BUILD / RENDER ===
+
+/**
+ * @brief Formats the burst with the usual MessageHandler builders, once.
+ *
+ * The builders are called with one-character markers instead of the nickname and
+ * the usermask, so the cached lines are exactly the ones they produce. The result
+ * is then cut at each marker.
+ *
+ * @param serverCreationTime The creation date shown in 003.
+ */
+void RegistrationBurst::build(const std::string& serverCreationTime) {
+	const std::string nickname(1, NICKNAME_MARK);
+	const std::string usermask(1, USERMASK_MARK);
+
+	std::string burst;
+	burst += MessageHandler::ircFormat(MessageHandler::ircWelcomeMessage(nickname, usermask));
+	burst += MessageHandler::ircFormat(MessageHandler::ircHostInfos(nickname));
+	burst += MessageHandler::ircFormat(MessageHandler::ircTimeCreation(nickname, serverCreationTime));
+	burst += MessageHandler::ircFormat(MessageHandler::ircInfos(nickname));
+	burst += MessageHandler::ircFormat(MessageHandler::ircMOTDMessage(nickname));
+
+	_pieces.clear();
+	_fields.clear();
+	_staticSize = 0;
+
+	size_t start = 0;
+	for (size_t i = 0; i < burst.size(); ++i) {
+		if (burst[i] != NICKNAME_MARK && burst[i] != USERMASK_MARK)
+			continue;
+		_pieces.push_back(burst.substr(start, i - start));
+		_fields.push_back(burst[i] == NICKNAME_MARK ? NICKNAME : USERMASK);
+		start = i + 1;
+	}
+	_pieces.push_back(burst.substr(start));
+	_fields.push_back(NONE);
+
+	for (size_t i = 0; i < _pieces.size(); ++i)
+		_staticSize += _pieces[i].size();
+}
+
+/**
+ * @brief Appends the burst of a client to `out`, ready to be queued as is.
+ *
+ * @param nickname The nickname of the client.
+ * @param usermask The usermask of the client (nick!user@host).
+ * @param out The string receiving the lines.
+ */
+void RegistrationBurst::render(const std::string& nickname, const std::string& usermask, std::string& out) const {
+	out.reserve(out.size() + _staticSize + _pieces.size() * (nickname.size() + 1) + usermask.size());
+	for (size_t i = 0; i < _pieces.size(); ++i) {
+		out += _pieces[i];
+		if (_fields[i] == NICKNAME)
+			out += nickname;
+		else if (_fields[i] == USERMASK)
+			out += usermask;
+	}
+}
@@ -0,0 +1,127 @@
+#include "../../incs/classes/SendQueue.hpp"
+
+#include <sys/socket.h>			// sendmsg() -> MSG_NOSIGNAL
+#include <sys/uio.h>			// struct iovec
+#include <cerrno>				// errno
+#include <cstring>				// memset()
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+// --- PUBLIC
+SendQueue::SendQueue(size_t limit) : _offset(0), _size(0), _limit(limit), _overflowed(false), _blocked(false) {}
+SendQueue::~SendQueue() {}
+
+// --- PRIVATE
+SendQueue::SendQueue(const SendQueue& src) {(void) src;}
+SendQueue& SendQueue::operator=(const SendQueue& src) {(void) src; return *this;}
+
+
+// === QUEUE ===
+
+/**
+ * @brief Appends data at the end of the queue.
+ *
+ * Nothing is written here: the caller schedules a flush, so that all the lines produced
+ * while handling a command leave in a single system call.
+ *
+ * @param data The bytes to send (already IRC formatted), shared and not copied.
+ * @return true if the data was queued, false if the sendq limit is exceeded.
+ */
+bool SendQueue::push(const SharedBuffer& data) {
+	if (_overflowed)
+		return false;
+	if (_size + data.size() > _limit) {
+		// Client trop lent : inutile de garder le reste, il va être déconnecté
+		clear();
+		_overflowed = true;
+		return false;
+	}
+	if (data.empty())
+		return true;
+	_chunks.push_back(data);
+	_size += data.size();
+	return true;
+}
+
+/**
+ * @brief Writes as much queued data as the socket accepts.
+ *
+ * Up to server::SENDQ_IOV_MAX chunks are gathered in an iovec array and sent with one
+ * sendmsg() call (writev() with MSG_NOSIGNAL, so a closed peer can't raise SIGPIPE).
+ * Sent bytes are removed from the queue, a partial write only advances the offset in
+ * the first chunk.
+ *
+ * @param fd The client socket (non-blocking).
+ * @return FLUSH_DONE when the queue is empty, FLUSH_PENDING on EAGAIN, FLUSH_ERROR otherwise.
+ */
+SendQueue::FlushStatus SendQueue::flush(int fd) {
+
+	struct iovec iov[server::SENDQ_IOV_MAX];
+
+	while (!_chunks.empty()) {
+
+		// On rassemble les chunks en attente dans le tableau iovec
+		size_t count = 0;
+		for (std::deque<SharedBuffer>::const_iterator it = _chunks.begin(); it != _chunks.end() && count < server::SENDQ_IOV_MAX; ++it, ++count) {
+			size_t skip = (count == 0) ? _offset : 0;
+			iov[count].iov_base = const_cast<char*>(it->data() + skip);
+			iov[count].iov_len = it->size() - skip;
+		}
+
+		struct msghdr msg;
+		std::memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = iov;
+		msg.msg_iovlen = count;
+
+		ssize_t sent = sendmsg(fd, &msg, MSG_NOSIGNAL);
+		if (sent < 0) {
+			if (errno == EINTR)
+				continue;
+			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+				_blocked = true;
+				return FLUSH_PENDING;
+			}
+			return FLUSH_ERROR;
+		}
+
+		_blocked = false;
+
+		// On retire ce qui a été envoyé (le dernier chunk peut n'être que partiellement envoyé)
+		size_t remaining = static_cast<size_t>(sent);
+		_size -= remaining;
+		while (remaining > 0) {
+			size_t left = _chunks.front().size() - _offset;
+			if (remaining < left) {
+				_offset += remaining;
+				break;
+			}
+			remaining -= left;
+			_offset = 0;
+			_chunks.pop_front();
+		}
+	}
+	return FLUSH_DONE;
+}
+
+void SendQueue::clear() {
+	_chunks.clear();
+	_offset = 0;
+	_size = 0;
+}
+
+
+// === GETTERS ===
+
+bool SendQueue::empty() const {
+	return _chunks.empty();
+}
+size_t SendQueue::size() const {
+	return _size;
+}
+bool SendQueue::overflowed() const {
+	return _overflowed;
+}
+bool SendQueue::blocked() const {
+	return _blocked;
+}
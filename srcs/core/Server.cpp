@@ -12,19 +12,30 @@ using namespace colors;
 /**
  * @brief A static volatile variable to store the signal received status.
  * 
- * This variable is used to indicate whether a signal has been received.
+ * This variable is used to indicate whether a signal has been received
+ * (it holds the signal number, 0 if none).
  * It is declared as volatile to prevent the compiler from optimizing
  * out accesses to it, as it may be modified asynchronously by a signal
  * handler.
  */
 volatile sig_atomic_t Server::signalReceived = boolean::FALSE;
 
+/**
+ * @brief Self-pipe written by the signal handler.
+ *
+ * The event loop may sleep until the next timer (or forever without clients):
+ * writing a byte to this pipe wakes the poller up so the signal is handled at once.
+ */
+int Server::_signalPipe[2] = {-1, -1};
+
 /**
  * @brief Signal handler for the server.
  *
  * This function handles the SIGINT and SIGTSTP signals, which are typically
  * generated by pressing Ctrl+C or Ctrl+Z, respectively. When these signals are
- * caught, the server sets signalReceived to true to clean and terminate the program.
+ * caught, the server sets signalReceived to clean and terminate the program.
+ * Only async-signal-safe calls are made here: the message is logged by the main loop
+ * once it has stopped (see _start()).
  *
  * @param signal The signal number that was caught.
  *
@@ -32,16 +43,12 @@ volatile sig_atomic_t Server::signalReceived = boolean::FALSE;
  */
 void Server::signalHandler(int signal) {
 
-	const char* signalType;
-
-	switch (signal) {
-		case SIGINT: signalType = "SIGINT"; break;
-		case SIGTSTP: signalType = "SIGTSTP"; break;
-		default: signalType = "Unknown";
-	}
+	signalReceived = signal;
 
-	std::cout << MessageHandler::msgSignalCaught(signalType) << std::endl;
-	signalReceived = boolean::TRUE;
+	// Réveille le poller (write() est async-signal-safe, errno est préservé pour le code interrompu)
+	int savedErrno = errno;
+	if (_signalPipe[1] >= 0 && write(_signalPipe[1], "!", 1) < 0) {}
+	errno = savedErrno;
 }
 
 
@@ -51,7 +58,7 @@ void Server::signalHandler(int signal) {
  * @brief Constructor for the Server class.
  *
  * Initializes the server with the given port and password.
- * Sets the server socket file descriptor and maximum file descriptor to -1 and 0, respectively.
+ * The event loops (reactors) and their listening sockets are created in _init().
  *
  * @param port The port number for the server to listen on. It must be a valid port number (0-65535).
  * @param password The password required for clients to connect to the server. It must be a non-empty string.
@@ -59,7 +66,8 @@ void Server::signalHandler(int signal) {
  * @throws std::invalid_argument If the port number is not within the valid range or if the password is invalid or empty.
 */
 Server::Server(const std::string &port, const std::string &password)
-	: _serverSocketFd(-1), _maxFd(0), _files() {
+	: _reusePort(false), _nextClientId(0), _commandStats(CommandHandler::commandCount()), _registeredCount(0), _offers(),
+	_bandwidth(server::DCC_TOTAL_RATE, server::DCC_CHUNK_SIZE) {
 
 	_port = IrcHelper::validatePort(port);
 
@@ -67,7 +75,19 @@ Server::Server(const std::string &port, const std::string &password)
 		throw std::invalid_argument(ERR_INVALID_PASSWORD);
 	_password = password;
 
-	_init();
+	// OPER n'est possible que si un mot de passe opérateur est fourni par l'environnement
+	const char* operPassword = getenv(server::OPER_PASSWORD_ENV.c_str());
+	if (operPassword)
+		_operPassword = operPassword;
+
+	// Les messages du serveur sont écrits par le thread de log, la boucle n'attend jamais la sortie
+	Logger::start(Logger::levelFromEnv());
+	try {
+		_init();
+	} catch (...) {
+		Logger::stop();
+		throw;
+	}
 }
 
 /**
@@ -95,7 +115,7 @@ void Server::launch() {
 	try {
 		_start();
 	} catch (const std::exception &e) {
-		std::cerr << MessageHandler::msgServerException(e) << std::endl;
+		Logger::error(MessageHandler::msgServerException(e));
 	}
 }
 
@@ -115,6 +135,30 @@ const std::string& Server::getServerPassword() const {
 	return _password;
 }
 
+/**
+ * @brief Tells if OPER is enabled (an operator password is given by the environment).
+ */
+bool Server::hasOperPassword() const {
+	return !_operPassword.empty();
+}
+
+/**
+ * @brief Checks an OPER password against the one given by the environment.
+ *
+ * @param password The password sent with OPER.
+ * @return bool false if it does not match, or if no operator password is configured.
+ */
+bool Server::isOperPassword(const std::string& password) const {
+	return !_operPassword.empty() && password == _operPassword;
+}
+
+/**
+ * @brief Returns the per-command statistics (read and written under the state lock).
+ */
+CommandStats& Server::getCommandStats() {
+	return _commandStats;
+}
+
 
 // === CLIENTS ===
 
@@ -146,65 +190,120 @@ int Server::getTotalClientCount() const {
  * @return int The number of clients that match the specified authentication status.
  */
 int Server::getClientCount(bool authenticated) {
-	int count = 0;
-	for (std::map<int, Client*>::iterator it = _clients.begin(); it != _clients.end(); ++it) {
-		if (authenticated && (it->second)->isAuthenticated())
-			count++;
-		else if (!authenticated && !(it->second)->isAuthenticated())
-			count++;
-	}
-	return count;
+	// Compteur tenu à jour à l'enregistrement et à la suppression des clients : O(1)
+	if (authenticated)
+		return _registeredCount;
+	return _clients.size() - _registeredCount;
 }
 
 /**
  * @brief Retrieves the client ID associated with a given nickname.
  *
- * This function iterates through the list of clients and returns the ID of the client
- * whose nickname matches the provided nickname. If the optional currClient parameter
- * is provided, it will be skipped during the search.
+ * This function looks the nickname up in the nickname index (O(1), RFC 1459 case
+ * mapping) and returns the ID of the client owning it. If the optional currClient
+ * parameter is provided, it will be skipped during the search.
  *
  * @param nickname The nickname of the client to search for.
  * @param currClient Optional parameter to specify a client to be skipped during the search.
  * @return The ID of the client with the matching nickname, or -1 if no match is found.
  */
 int Server::getClientByNickname(const std::string &nickname, Client* currClient) {
-	for (std::map<int, Client*>::iterator it = _clients.begin(); it != _clients.end(); it++) {
-		if (currClient && currClient == it->second)
-			continue;
-		if (nickname == (it->second)->getNickname()) 
-			return it->first;
-	}
-	return -1;
+	Client* client = _nicknames.find(nickname);
+	if (!client || (currClient && currClient == client))
+		return -1;
+	return client->getFd();
+}
+
+/**
+ * @brief Finds a client by its socket and connection number, if it is still connected.
+ *
+ * Used once a deferred operation is over (DCC copy, worker job): the client may have
+ * left since, and its fd been given to a new connection.
+ *
+ * @param fd The socket of the client when the operation started.
+ * @param id Its connection number.
+ * @return Client* The client, NULL if it left (or is leaving).
+ */
+Client* Server::getConnectedClient(int fd, unsigned long id) {
+	std::map<int, Client*>::iterator it = _clients.find(fd);
+	if (it == _clients.end() || it->second->getId() != id || it->second->isLeaving())
+		return NULL;
+	return it->second;
 }
 
 /**
- * @brief Sends a greeting message to a newly connected client.
+ * @brief Changes the nickname of a client and keeps the nickname index up to date.
+ *
+ * The old nickname is released and the new one registered in the same call, so the
+ * index never points to a stale nickname.
+ *
+ * @param client The client whose nickname changes.
+ * @param nickname The new nickname.
+ * @return false if the nickname is already owned by another client (nothing is changed).
+ */
+bool Server::setClientNickname(Client* client, const std::string& nickname) {
+	Client* owner = _nicknames.find(nickname);
+	if (owner && owner != client)
+		return false;
+
+	_nicknames.remove(client->getNickname(), client);
+	client->setNickname(nickname);
+	_nicknames.add(nickname, client);
+	return true;
+}
+
+/**
+ * @brief Retrieves the nickname index (nickname -> client, RFC 1459 case mapping).
+ *
+ * @return const NicknameIndex& Reference to the index.
+ */
+const NicknameIndex& Server::getNicknameIndex() const {
+	return _nicknames;
+}
+
+/**
+ * @brief Marks a client as registered (NICK, USER and PASS done) and welcomes it.
+ *
+ * The registered client counter used by LUSERS is updated here, and decremented
+ * when the client is deleted. Must be called with the server state locked.
  *
- * This function sends a series of welcome messages to the client, including:
+ * @param client The client that just completed its registration.
+ */
+void Server::registerClient(Client* client) {
+	client->authenticate();
+	++_registeredCount;
+	_greetClient(client);
+}
+
+/**
+ * @brief Sends the welcome burst to a newly registered client.
+ *
+ * The burst contains:
  * - A welcome message with the client's username, nickname, and IP address.
  * - Host information.
  * - Server creation time.
  * - Additional server information.
+ * - The message of the day.
  * - A global user list with the total number of clients, known clients, unknown clients, and channels.
  *
- * @param client A pointer to the Client object representing the newly connected client.
+ * Everything but the user list is pre-rendered at startup (RegistrationBurst), only the
+ * nickname and the usermask are patched in. The counts are kept up to date by the server,
+ * so a registration costs no pass over the clients. The whole burst is queued as one buffer.
+ *
+ * @param client A pointer to the Client object representing the newly registered client.
  */
-void Server::greetClient(Client* client) {
+void Server::_greetClient(Client* client) {
 	const std::string& nickname = client->getNickname();
-	const std::string& usermask = client->getUsermask();
-
-	client->sendMessage(MessageHandler::ircWelcomeMessage(nickname, usermask), NULL);
-	client->sendMessage(MessageHandler::ircHostInfos(nickname), NULL);
-	client->sendMessage(MessageHandler::ircTimeCreation(nickname, _timeCreationStr), NULL);
-	client->sendMessage(MessageHandler::ircInfos(nickname), NULL);
-	client->sendMessage(MessageHandler::ircMOTDMessage(nickname), NULL);
 
 	int totalClientCount = getTotalClientCount();
 	int unknownClientCount = getClientCount(false);
 	int knownClientCount = getClientCount(true);
 	int channelCount = getChannelCount();
 
-	client->sendMessage(MessageHandler::ircGlobalUserList(nickname, totalClientCount, knownClientCount, unknownClientCount, channelCount), NULL);
+	std::string burst;
+	_registrationBurst.render(nickname, client->getUsermask(), burst);
+	burst += MessageHandler::ircFormat(MessageHandler::ircGlobalUserList(nickname, totalClientCount, knownClientCount, unknownClientCount, channelCount));
+	client->queueRawMessage(SharedBuffer::adopt(burst));
 }
 
 /**
@@ -212,7 +311,10 @@ void Server::greetClient(Client* client) {
  *
  * This function handles the necessary steps to properly disconnect a client from the server.
  * It ensures that the client leaves all channels they are part of, disconnects the client,
- * and marks the client for deletion.
+ * and marks the client for deletion. Calling it twice for the same client is a no-op,
+ * so a client can't be scheduled for deletion twice in the same loop iteration.
+ * The client is deleted at the end of the loop iteration by the reactor that owns it.
+ * Must be called with the server state locked.
  *
  * @param it An iterator pointing to the client in the map of clients.
  */
@@ -220,9 +322,13 @@ void Server::prepareClientToLeave(std::map<int, Client*>::iterator it, const std
 	int clientFd = it->first;
 	Client* client = it->second;
 
+	if (client->isLeaving())
+		return;
+	client->setLeaving();
+
 	client->leaveAllChannels(_channels, reason, leaving_code::QUIT_SERV);
 	_disconnectClient(clientFd, reason);
-	_clientsToDelete.push_back(it);
+	_reactors[client->getReactorIndex()]->clientsToDelete.push_back(it);
 }
 
 
@@ -250,19 +356,42 @@ int Server::getChannelCount() const {
 	return _channels.size();
 }
 
+
+// === WORKER POOL ===
+
 /**
- * @brief Broadcasts a message for nickname change to all connected and authenticated clients except those marked for deletion.
- * 
- * This function iterates through the list of connected clients and sends the specified
- * message to each client that is not present in the list of clients to be deleted.
- * 
- * @param message The message to be broadcasted to all connected and authenticated clients.
+ * @brief Hands a blocking operation to the worker pool, on behalf of a client.
+ *
+ * Called by a command, on the thread of the reactor of the client: the job comes back
+ * to this reactor once it has run (see _runCompletions()).
+ *
+ * @param client The client whose command submits the job.
+ * @param job The job, owned by the pool from now on.
  */
-void Server::broadcastToClients(const std::string &message) {
-	for (std::map<int, Client*>::iterator it = _clients.begin(); it != _clients.end(); ++it) {
-		std::vector<std::map<int, Client*>::iterator>::iterator itDeleted = std::find(_clientsToDelete.begin(), _clientsToDelete.end(), it);
-		if (itDeleted == _clientsToDelete.end() && it->second->isAuthenticated())
-			it->second->sendMessage(message, NULL);
+void Server::submitJob(Client* client, WorkerJob* job) {
+	_workers.submit(job, _reactors[client->getReactorIndex()]->completions);
+}
+
+/**
+ * @brief Completes the jobs of a reactor that the worker pool has run.
+ *
+ * The completions run like commands, under the server state lock, taken once for all
+ * the jobs over since the last iteration.
+ *
+ * @param reactor The reactor whose jobs are completed.
+ */
+void Server::_runCompletions(Reactor& reactor) {
+
+	WorkerJob* job = reactor.completions.take();
+	if (!job)
+		return;
+
+	MutexLock lock(_stateLock);
+	while (job) {
+		WorkerJob* next = CompletionQueue::next(job);
+		job->complete(*this);
+		delete job;
+		job = next;
 	}
 }
 
@@ -270,22 +399,262 @@ void Server::broadcastToClients(const std::string &message) {
 // === SEND FILE (BONUS) ===
 
 /**
- * @brief Retrieves the map of files stored in the server.
- * 
- * This function returns a reference to the map that contains all the files
- * managed by the server. The map uses the file name as the key and the 
- * corresponding File object as the value.
- * 
- * @return std::map<std::string, File>& Reference to the map of files.
+ * @brief Retrieves the registry of the pending DCC offers.
+ *
+ * Offers are looked up and removed in place, by (sender, receiver, filename).
+ *
+ * @return DccOffers& Reference to the offer registry.
+ */
+DccOffers& Server::getOffers() {
+	return (_offers);
+}
+
+/**
+ * @brief Registers a DCC offer and schedules its expiry.
+ *
+ * Called by the SEND command, on the thread of the reactor of the sender: the expiry
+ * timer goes to that reactor, which drops the offer after server::DCC_OFFER_TTL seconds
+ * if nobody took it (see _runTimers()).
+ *
+ * @param sender The client offering the file.
+ * @param file The offered file.
+ * @return bool False if the sender has too many offers pending (quota).
+ */
+bool Server::addOffer(Client* sender, const File& file) {
+	unsigned long id = _offers.add(file, sender->getId());
+	if (id == 0)
+		return false;
+	_reactors[sender->getReactorIndex()]->offerTimers.schedule(time(NULL) + server::DCC_OFFER_TTL, -1, id);
+	return true;
+}
+
+/**
+ * @brief Hands a DCC GET copy to the reactor of the client receiving the file.
+ *
+ * Called by the GET command, which runs on the thread of that reactor: the copy is
+ * then only touched by this thread, chunk by chunk (see _runTransfers()).
+ *
+ * @param receiver The client receiving the file (the one that sent GET).
+ * @param transfer The opened copy, owned by the reactor from now on.
+ */
+void Server::startTransfer(Client* receiver, FileTransfer* transfer) {
+	_reactors[receiver->getReactorIndex()]->transfers.push_back(transfer);
+}
+
+/**
+ * @brief Lists the DCC copies in progress on every reactor (STATS d).
+ *
+ * The lists of the reactors only change under the server state lock, which the caller
+ * holds: the copies stay valid until it releases it.
+ *
+ * @return std::vector<const FileTransfer*> The copies in progress.
  */
-std::map<std::string, File>& Server::getFiles() {
-	return (_files);
+std::vector<const FileTransfer*> Server::getTransfers() const {
+	std::vector<const FileTransfer*> transfers;
+	for (size_t i = 0; i < _reactors.size(); ++i)
+		transfers.insert(transfers.end(), _reactors[i]->transfers.begin(), _reactors[i]->transfers.end());
+	return transfers;
+}
+
+/**
+ * @brief Reserves the paths of a DCC GET copy, from GET to the end of the copy.
+ *
+ * Every GET writes into $HOME: two copies of files with the same name, whoever sent
+ * them, would write the same file, and a copy could cut a file another one is reading.
+ * A file may be read by several copies, but a file being written is neither read nor
+ * written by another one. Called with the server state lock held.
+ *
+ * @param source The path of the offered file.
+ * @param dest The path of the copy.
+ * @return bool False if another copy uses these paths: nothing is reserved.
+ */
+bool Server::reserveCopy(const std::string& source, const std::string& dest) {
+	if (_copyDestinations.count(dest) || _copySources.count(dest) || _copyDestinations.count(source))
+		return false;
+	_copyDestinations.insert(dest);
+	++_copySources[source];
+	return true;
+}
+
+// La copie est finie, ou n'a pas pu commencer
+void Server::releaseCopy(const std::string& source, const std::string& dest) {
+	_copyDestinations.erase(dest);
+	std::map<std::string, size_t>::iterator it = _copySources.find(source);
+	if (it != _copySources.end() && --it->second == 0)
+		_copySources.erase(it);
+}
+
+// Un fichier lu ou écrit par une copie en cours (RESUME, ACCEPT)
+bool Server::isCopyPath(const std::string& path) const {
+	return _copyDestinations.count(path) || _copySources.count(path);
+}
+
+/**
+ * @brief Compares an opened copy with the copies in progress, file by file.
+ *
+ * The paths reserved by reserveCopy() may still name the same file in two ways
+ * (links, "." or ".."): the opened files are compared before the copy starts writing.
+ * Called with the server state lock held: the lists of the reactors don't change.
+ *
+ * @param transfer The copy about to start.
+ * @return bool True if it would write a file another copy uses, or read one it writes.
+ */
+bool Server::copyConflicts(const FileTransfer* transfer) const {
+	for (size_t i = 0; i < _reactors.size(); ++i) {
+		const std::vector<FileTransfer*>& transfers = _reactors[i]->transfers;
+		for (size_t j = 0; j < transfers.size(); ++j)
+			if (transfer->sharesFile(*transfers[j]))
+				return true;
+	}
+	return false;
+}
+
+/**
+ * @brief Hands the next chunk of the DCC GET copies of a reactor that have bandwidth to the pool.
+ *
+ * Called once the chat lines of the iteration are sent. Each copy is limited to
+ * server::DCC_TRANSFER_RATE and all the copies of the server together to
+ * server::DCC_TOTAL_RATE (token buckets): a copy without enough tokens is skipped, and
+ * the reactor sleeps until the first one gets some (transferDelay) instead of spinning.
+ * If clients were served during the iteration, only one copy goes on (each its turn).
+ *
+ * A chunk is copied by a worker thread (CopyChunkJob), one at a time per copy: the
+ * reactor never waits for the disk, and the end of the chunk wakes it up. The server
+ * state lock is only taken when a copy is over (see _endTransfer()).
+ *
+ * @param reactor The reactor whose copies are advanced.
+ * @param interactive True if clients were served during this iteration.
+ * @return bool True if a copy ended: its messages are waiting to be sent.
+ */
+bool Server::_runTransfers(Reactor& reactor, bool interactive) {
+
+	// Rien à attendre d'autre que la fin des morceaux en cours, qui réveillera le reactor
+	reactor.transferDelay = static_cast<unsigned long>(-1);
+	if (reactor.transfers.empty())
+		return false;
+
+	std::vector<FileTransfer*>& transfers = reactor.transfers;
+	std::vector<FileTransfer*> ended;
+	unsigned long now = CommandStats::now();
+	size_t count = transfers.size();
+	size_t first = reactor.transferCursor++ % count;
+	bool submitted = false;
+
+	for (size_t n = 0; n < count; ++n) {
+
+		FileTransfer* transfer = transfers[(first + n) % count];
+		if (transfer->pending)
+			continue;
+		if (transfer->status != FileTransfer::IN_PROGRESS) {
+			ended.push_back(transfer);
+			continue;
+		}
+		// Des clients ont été servis pendant ce tour : les autres copies repartent au suivant
+		if (interactive && submitted) {
+			reactor.transferDelay = 0;
+			continue;
+		}
+
+		size_t grant = _grantTransfer(*transfer, now, reactor.transferDelay);
+		if (grant == 0)
+			continue;
+		transfer->pending = true;
+		_workers.submit(new CopyChunkJob(transfer, grant), reactor.completions);
+		submitted = true;
+	}
+
+	if (ended.empty())
+		return false;
+
+	MutexLock lock(_stateLock);
+	for (size_t i = 0; i < ended.size(); ++i) {
+		_endTransfer(ended[i], ended[i]->status, now);
+		transfers.erase(std::find(transfers.begin(), transfers.end(), ended[i]));
+		delete ended[i];
+	}
+	return true;
+}
+
+/**
+ * @brief Draws the bytes of the next chunk of a copy from its bucket and the server one.
+ *
+ * A chunk is never smaller than server::DCC_MIN_CHUNK (or what is left of the file):
+ * below, the copy waits for its tokens rather than copying crumbs.
+ * Both buckets are charged with the whole grant, before the copy: a chunk cut short
+ * by the end of the file costs a few bytes more, never less.
+ *
+ * @param transfer The copy to advance.
+ * @param now The current time (us).
+ * @param wait Lowered to the delay before the copy may go on, if it can't now.
+ * @return size_t The bytes the copy may copy now, 0 if it must wait.
+ */
+size_t Server::_grantTransfer(FileTransfer& transfer, unsigned long now, unsigned long& wait) {
+
+	off_t left = transfer.size() - transfer.offset();
+	size_t wanted = left < static_cast<off_t>(server::DCC_CHUNK_SIZE) ? static_cast<size_t>(left) : server::DCC_CHUNK_SIZE;
+	if (wanted == 0)
+		return 1;
+	size_t minimum = std::min(wanted, server::DCC_MIN_CHUNK);
+
+	size_t grant = std::min(wanted, transfer.bandwidth.available(now));
+	if (grant < minimum) {
+		wait = std::min(wait, transfer.bandwidth.delay(minimum));
+		return 0;
+	}
+	if (_bandwidth.limited()) {
+		MutexLock lock(_bandwidthLock);
+		grant = std::min(grant, _bandwidth.available(now));
+		if (grant < minimum) {
+			wait = std::min(wait, _bandwidth.delay(minimum));
+			return 0;
+		}
+		_bandwidth.consume(grant);
+	}
+	transfer.bandwidth.consume(grant);
+	return grant;
+}
+
+/**
+ * @brief Ends a copy: its offer, its paths, the messages to both clients and the log.
+ *
+ * Called with the server state lock held. The clients are told only if they are still
+ * connected: a copy goes on when its clients leave, the file is written anyway.
+ * A complete copy consumes its offer; after a failure the offer stays, so the receiver
+ * can resume the copy where it stopped (DCC RESUME / ACCEPT, then GET).
+ *
+ * @param transfer The copy that ended.
+ * @param status DONE or FAILED.
+ * @param now The current time (us), for the throughput.
+ */
+void Server::_endTransfer(FileTransfer* transfer, FileTransfer::Status status, unsigned long now) {
+
+	bool done = status == FileTransfer::DONE;
+	_offers.copyEnded(transfer->offerId, done);
+	releaseCopy(transfer->sourcePath, transfer->destPath);
+
+	Client* receiver = getConnectedClient(transfer->receiverFd, transfer->receiverId);
+	Client* sender = getConnectedClient(transfer->senderFd, transfer->senderId);
+	std::string stats = MessageHandler::msgTransferStats(transfer->copied(), transfer->throughput(now));
+
+	if (done) {
+		if (receiver)
+			receiver->sendMessage("DCC received file " + transfer->name + " from " + transfer->sender + " " + stats, NULL);
+		if (sender)
+			sender->sendMessage("DCC sent file " + transfer->name + " for " + transfer->receiver + " " + stats, NULL);
+	}
+	else if (receiver) {
+		std::ostringstream stream;
+		stream << "DCC transfer of " << transfer->name << " from " << transfer->sender << " failed at "
+			<< transfer->offset() << " (DCC RESUME " << transfer->sender << " " << transfer->name << " to resume)";
+		receiver->sendMessage(stream.str(), NULL);
+	}
+	Logger::info(MessageHandler::msgTransferEnded(transfer->name, transfer->sender, transfer->receiver, done, stats));
 }
 
 /**************************************** PRIVATE ****************************************/
 
-Server::Server() {}
-Server::Server(const Server& src) {(void) src;}
+Server::Server() : _commandStats(0), _bandwidth(0, 0) {}
+Server::Server(const Server& src) : _commandStats(0), _bandwidth(0, 0) {(void) src;}
 Server & Server::operator=(const Server& src) {(void) src; return *this;}
 
 
@@ -364,34 +733,46 @@ void Server::_setLocalIp() { // Configure l'adresse réseau pour permettre aux c
 }
 
 /**
- * @brief Sets up the server socket, binds it to an address and port, and listens for incoming connections.
+ * @brief Creates a listening socket, binds it to the server port and listens for incoming connections.
  *
  * This function creates a server socket, sets it to non-blocking mode, and binds it to a specific address and port.
- * It also listens for incoming connections and initializes the necessary variables for the server to function properly.
+ * With SO_REUSEPORT, every reactor binds its own socket to the same port and the kernel
+ * spreads the incoming connections between them.
  *
- * @return void
+ * @param reusePort Whether SO_REUSEPORT must be set on the socket.
+ *
+ * @return int The listening socket.
  *
  * @throws std::runtime_error If any error occurs during the setup of the server socket.
  */
-void Server::_setServerSocket() {
+int Server::_createListener(bool reusePort) {
 
 	// Création du socket serveur (socket TCP)
-	_serverSocketFd = socket(AF_INET, SOCK_STREAM, 0);
-	if (_serverSocketFd < 0)
+	int listenFd = socket(AF_INET, SOCK_STREAM, 0);
+	if (listenFd < 0)
 		throw std::runtime_error(ERR_SOCKET_CREATION);
 
 	// Réutilisation de l'adresse et du port :
 	// Après un arrêt brutal du serveur, si ce dernier n'a pas libéré immédiatement le port, 
 	// SO_REUSEADDR permet de réutiliser le port pour se connecter sans attendre le délai habituel.
 	int opt = 1;
-	if (setsockopt(_serverSocketFd, SOCK_STREAM, SO_REUSEADDR, &opt, sizeof(opt)) < 0)
+	if (setsockopt(listenFd, SOCK_STREAM, SO_REUSEADDR, &opt, sizeof(opt)) < 0)
+		throw std::runtime_error(ERR_SET_SOCKET);
+
+#ifdef SO_REUSEPORT
+	// Plusieurs sockets d'écoute sur le même port : un par reactor,
+	// le noyau répartit les nouvelles connexions entre eux
+	if (reusePort && setsockopt(listenFd, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt)) < 0)
 		throw std::runtime_error(ERR_SET_SOCKET);
+#else
+	(void) reusePort;
+#endif
 
 	// Rendre le socket non-bloquant avec O_NONBLOCK :
 	// Le serveur doit être capable de gérer plusieurs connexions simultanées sans forking (interdit ici).
 	// Il doit donc être non-bloquant (ne pas se bloquer tant qu'il n'a pas de nouvelles connexions, traité de message etc...)
 	// On pourra donc traiter tous nos clients en continu dans une boucle sans interruption -> voir dans start()
-	if (fcntl(_serverSocketFd, F_SETFL, O_NONBLOCK) < 0)
+	if (fcntl(listenFd, F_SETFL, O_NONBLOCK) < 0)
 		throw std::runtime_error(ERR_SET_SERVER_NON_BLOCKING);
 
 	// Définition de l'adresse du serveur
@@ -403,97 +784,231 @@ void Server::_setServerSocket() {
 	serverAddr.sin_port = htons(_port); // Port sur lequel écouter (converti en format réseau)
 
 	// Associer l'adresse définie au socket
-	if (bind(_serverSocketFd, (struct sockaddr*)&serverAddr, sizeof(serverAddr)) < 0)
+	if (bind(listenFd, (struct sockaddr*)&serverAddr, sizeof(serverAddr)) < 0)
 		throw std::runtime_error(ERR_BIND_SOCKET);
 
 	// Ecouter les connexions entrantes
-	// -> FD_SETSIZE spécifie le nombre max de connexions simultanées autorisées par select() (ici 1024)
-	if (listen(_serverSocketFd, FD_SETSIZE) < 0)
+	// -> le backlog est la file des connexions pas encore acceptées, pas une limite de clients :
+	// on prend le maximum autorisé par le système (SOMAXCONN)
+	if (listen(listenFd, SOMAXCONN) < 0)
 		throw std::runtime_error(ERR_LISTEN_SOCKET);
 
-	// _readFds = ensemble de descripteurs à surveiller pour les connexions/déconnexions, lecture/envoi de messages...
-	// Sera mis à jour via une copie temporaire dans la boucle infinie de start()
-	// FD_ZERO initialise _readFds à zéro pour s'assurer qu'il est vide avant d'y ajouter de nouveaux descripteurs
-	FD_ZERO(&_readFds);
-
-	// Ajout du socket du serveur (_serverSocketFd) à l'ensemble de descripteurs (_readFds)
-	// pour écouter les connexions entrantes
-	// NB: Nous n'ajoutons pas le serveur à l'ensemble de descripteurs pour l'écriture (_writeFds)
-	FD_SET(_serverSocketFd, &_readFds); // Ajouter le socket serveur à l'ensemble
+	return listenFd;
+}
 
-	// Le serveur peut maintenant accepter les connexions entrantes via select()
+/**
+ * @brief Reads how many event loop threads must be started.
+ *
+ * The count comes from the IRCSERV_REACTORS environment variable. Without it (or with
+ * an invalid value) the server keeps a single event loop on the main thread.
+ *
+ * @return size_t The number of reactors, between 1 and server::REACTORS_MAX.
+ */
+size_t Server::_reactorCount() {
+	const char* value = getenv(server::REACTORS_ENV.c_str());
+	if (!value)
+		return 1;
+
+	long count = std::strtol(value, NULL, 10);
+	if (count < 1)
+		return 1;
+	if (static_cast<size_t>(count) > server::REACTORS_MAX)
+		return server::REACTORS_MAX;
+	return static_cast<size_t>(count);
 }
 
 /**
- * @brief Get the maximum file descriptor currently in use by the server.
+ * @brief Creates the event loops (reactors) and their listening sockets.
  *
- * This function checks the highest file descriptor among the connected clients
- * and updates the server's maximum file descriptor (_maxFd) if a higher value
- * is found. It then returns the maximum file descriptor.
+ * Reactor 0 runs on the main thread, the others get their own thread in _start().
+ * When the platform supports SO_REUSEPORT, each reactor listens on its own socket and
+ * accepts its own clients. Otherwise they all watch the same listening socket and the
+ * first one to accept a connection owns it.
  *
- * @return int The maximum file descriptor currently in use by the server.
+ * @throws std::runtime_error If a poller, a pipe or a listening socket can't be created.
  */
-int Server::_getMaxFd() {
+void Server::_setReactors() {
+
+	size_t count = _reactorCount();
+#ifdef SO_REUSEPORT
+	_reusePort = count > 1;
+#endif
+
+	for (size_t i = 0; i < count; ++i) {
+		_reactors.push_back(new Reactor(i, this));
+		Reactor* reactor = _reactors.back();
 
-	if (!_clients.empty()) {
-		int maxClientFd = _clients.rbegin()->first;
-		if (maxClientFd > _maxFd)
-			return maxClientFd;
+		if (i == 0 || _reusePort) {
+			reactor->listenFd = _createListener(_reusePort);
+			reactor->ownsListener = true;
+		} else
+			reactor->listenFd = _reactors[0]->listenFd;
+
+		// Ajout du socket d'écoute au poller pour écouter les connexions entrantes
+		// NB: le serveur n'est jamais surveillé en écriture
+		if (!reactor->poller->add(reactor->listenFd, poll_event::READ))
+			throw std::runtime_error(ERR_POLLER_ADD);
 	}
-	return _serverSocketFd;
+
+	// Le serveur peut maintenant accepter les connexions entrantes via les pollers
+}
+
+
+/**
+ * @brief Creates the self-pipe used to wake the poller up when a signal is caught.
+ *
+ * Both ends are non-blocking: the handler never blocks, and the loop drains the
+ * pipe until EAGAIN. Only the main reactor watches it, it wakes the other ones up
+ * when the server stops.
+ */
+void Server::_setWakeupPipe() {
+	if (pipe(_signalPipe) < 0)
+		throw std::runtime_error(ERR_WAKEUP_PIPE);
+	if (fcntl(_signalPipe[0], F_SETFL, O_NONBLOCK) < 0 || fcntl(_signalPipe[1], F_SETFL, O_NONBLOCK) < 0
+		|| !_reactors[0]->poller->add(_signalPipe[0], poll_event::READ))
+		throw std::runtime_error(ERR_WAKEUP_PIPE);
 }
 
+void Server::_drainWakeupPipe() {
+	char buffer[64];
+	while (read(_signalPipe[0], buffer, sizeof(buffer)) > 0) {}
+}
 
 /**
- * @brief Initializes the server by setting up signals, local IP, server socket, and creation time.
+ * @brief Initializes the server by setting up signals, local IP, event loops, and creation time.
  * 
  * This function performs the following steps:
  * 1. Sets up signal handling by calling _setSignal().
  * 2. Retrieves and sets the local IP address by calling _setLocalIp().
- * 3. Creates and configures the server socket by calling _setServerSocket().
- * 4. Records the server creation time using MessageHandler::msgTimeServerCreation().
- * 5. Displays a welcome message with the local IP, port, and password using MessageHandler::displayWelcome().
+ * 3. Creates the event loops, each with its poller (epoll, or select() as a fallback)
+ *    and its listening socket, by calling _setReactors().
+ * 4. Creates the self-pipe that wakes the poller up on signals.
+ * 5. Records the server creation time using MessageHandler::msgTimeServerCreation().
+ * 6. Displays a welcome message with the local IP, port, and password using MessageHandler::displayWelcome().
  */
 void Server::_init() {
 
 	_setSignal();
 	_setLocalIp();
-	_setServerSocket();
+	_setReactors();
+	_setWakeupPipe();
 
 	_timeCreationStr = MessageHandler::msgTimeServerCreation();
+	_registrationBurst.build(_timeCreationStr);
 	MessageHandler::displayWelcome(_localIp, _port, _password);
+	if (_reactors.size() > 1)
+		Logger::info(MessageHandler::msgReactorsStarted(_reactors.size(), _reactors[0]->poller->name(), _reusePort));
 }
 
 /**
- * @brief Checks the activity of all connected clients and handles inactivity.
+ * @brief Computes how long the poller of a reactor may sleep.
+ *
+ * The loop sleeps until the earliest deadline, of a client or of a DCC offer (or until
+ * an event / a signal), there is no periodic wakeup anymore. DCC copies waiting for
+ * their bandwidth wake it up when the first one may go on (Reactor::transferDelay).
  *
- * This function iterates through all connected clients and performs the following actions:
+ * @param reactor The reactor whose timers are checked.
+ * @return int The timeout in milliseconds, -1 (infinite) if no timer is scheduled.
+ */
+int Server::_pollTimeout(const Reactor& reactor) const {
+	// Des clients attendent leur tour ou une copie de fichier peut avancer :
+	// on ne fait que relever les nouveaux événements
+	if (!reactor.backlog.empty() || (!reactor.transfers.empty() && reactor.transferDelay == 0))
+		return 0;
+
+	// Les copies attendent leur débit : on dort jusque-là au plus (arrondi à la milliseconde supérieure)
+	int transferTimeout = -1;
+	if (!reactor.transfers.empty() && reactor.transferDelay != static_cast<unsigned long>(-1))
+		transferTimeout = static_cast<int>(std::min(reactor.transferDelay / 1000 + 1, 1000UL));
+	if (reactor.timers.empty() && reactor.offerTimers.empty())
+		return transferTimeout;
+
+	time_t deadline;
+	if (reactor.offerTimers.empty())
+		deadline = reactor.timers.nextDeadline();
+	else if (reactor.timers.empty())
+		deadline = reactor.offerTimers.nextDeadline();
+	else
+		deadline = std::min(reactor.timers.nextDeadline(), reactor.offerTimers.nextDeadline());
+
+	time_t delay = deadline - time(NULL);
+	if (delay <= 0)
+		return 0;
+	if (transferTimeout >= 0 && transferTimeout < static_cast<int>(delay) * 1000)
+		return transferTimeout;
+	return static_cast<int>(delay) * 1000;
+}
+
+/**
+ * @brief Checks the activity of the clients whose deadline is reached and handles inactivity.
+ *
+ * Every client has exactly one timer, in the reactor that owns it. Its activity is only updated with a timestamp
+ * (Client::setLastActivity()), so when a timer fires the real deadline is recomputed:
+ * - If the client was active in the meantime, the timer is simply scheduled again.
  * - If a client has been inactive for more than 4 minutes, it sends a PING message to the client to check the connection.
  * - If a client has been inactive for more than 5 minutes (no PONG or command received), it prepares the client to be disconnected due to a connection timeout.
+ * The DCC offers made from this reactor expire the same way (DccOffers::expire()).
+ * Only expired timers are visited: idle connections cost nothing between two deadlines,
+ * and the server state is only locked when a timer actually fired.
+ *
+ * @param reactor The reactor whose timers are run.
  */
-void Server::_checkActivity() {
-	for (std::map<int, Client*>::iterator it = _clients.begin(); it != _clients.end(); ++it) {
-		
+void Server::_runTimers(Reactor& reactor) {
+
+	time_t now = time(NULL);
+	bool clientsDue = !reactor.timers.empty() && reactor.timers.nextDeadline() <= now;
+	bool offersDue = !reactor.offerTimers.empty() && reactor.offerTimers.nextDeadline() <= now;
+	if (!clientsDue && !offersDue)
+		return;
+
+	MutexLock lock(_stateLock);
+	Timer timer;
+
+	// Offres DCC sans GET arrivées à échéance (déjà prises ou remplacées : rien à faire, en cours de copie : plus tard)
+	while (reactor.offerTimers.popExpired(now, timer))
+		if (_offers.expire(timer.id))
+			reactor.offerTimers.schedule(now + server::DCC_OFFER_TTL, -1, timer.id);
+
+	while (reactor.timers.popExpired(now, timer)) {
+
+		// Le client a pu partir depuis (et son fd être réutilisé) : on vérifie son numéro de connexion
+		std::map<int, Client*>::iterator it = _clients.find(timer.fd);
+		if (it == _clients.end() || it->second->getId() != timer.id || it->second->isLeaving())
+			continue;
+
 		Client* client = it->second;
-		time_t idleTime = client->getIdleTime();
+		time_t lastActivity = client->getLastActivity();
+		time_t idleTime = now - lastActivity;
 
-		// Au bout de 4 minutes d'inactivité, envoie un PING au client pour vérifier sa connexion
-		if (!client->pingSent() && idleTime > server::PING_INTERVAL) {
-			client->setPingSent(true);
-			client->sendMessage(MessageHandler::ircPing(), NULL);
-		}
 		// Si le client est inactif depuis 5 minutes (pas de PONG ou de commande reçue), on le déconnecte
-		if (idleTime > server::PONG_TIMEOUT)
+		if (idleTime > server::PONG_TIMEOUT) {
 			prepareClientToLeave(it, CONNECTION_TIMEOUT);
+			continue;
+		}
+
+		// Au bout de 4 minutes d'inactivité, envoie un PING au client pour vérifier sa connexion
+		// et attend le PONG jusqu'au délai de déconnexion
+		if (idleTime > server::PING_INTERVAL) {
+			if (!client->pingSent()) {
+				client->setPingSent(true);
+				client->sendMessage(MessageHandler::ircPing(), NULL);
+			}
+			reactor.timers.schedule(lastActivity + server::PONG_TIMEOUT + 1, timer.fd, timer.id);
+			continue;
+		}
+
+		// Client actif entre temps : prochaine vérification à la fin de son délai d'inactivité
+		reactor.timers.schedule(lastActivity + server::PING_INTERVAL + 1, timer.fd, timer.id);
 	}
 }
 
 /**
  * @brief Starts the IRC server.
  *
- * This function initializes the server socket, listens for incoming client connections,
- * and handles client messages using the select() system call. It also manages client deletion
- * and handles exceptions.
+ * The worker pool and the extra reactors (if any) are started on their own threads, then
+ * the main thread runs reactor 0 until a signal is caught. The other reactors are then
+ * woken up and joined, so that _clean() runs alone (it stops the pool first).
+ * Signals are blocked in the reactor threads: they are always handled by the main thread.
  *
  * @return void
  *
@@ -501,56 +1016,177 @@ void Server::_checkActivity() {
  */
 void Server::_start() {
 
+	sigset_t blocked, previous;
+	sigemptyset(&blocked);
+	sigaddset(&blocked, SIGINT);
+	sigaddset(&blocked, SIGTSTP);
+	pthread_sigmask(SIG_BLOCK, &blocked, &previous);
+
+	// Les threads créés héritent du masque : seuls les signaux du thread principal sont traités
+	_workers.start(server::WORKER_THREADS);
+	for (size_t i = 1; i < _reactors.size(); ++i) {
+		if (pthread_create(&_reactors[i]->thread, NULL, &Server::_reactorThread, _reactors[i]) != 0) {
+			pthread_sigmask(SIG_SETMASK, &previous, NULL);
+			_stopReactors();
+			throw std::runtime_error(ERR_THREAD_CREATION);
+		}
+		_reactors[i]->threadStarted = true;
+	}
+	pthread_sigmask(SIG_SETMASK, &previous, NULL);
+
+	try {
+		_runReactor(*_reactors[0]);
+	} catch (...) {
+		_stopReactors();
+		throw;
+	}
+	_stopReactors();
+
+	const char* signalType;
+	switch (signalReceived) {
+		case SIGINT: signalType = "SIGINT"; break;
+		case SIGTSTP: signalType = "SIGTSTP"; break;
+		default: signalType = "Unknown";
+	}
+	Logger::warning(MessageHandler::msgSignalCaught(signalType));
+}
+
+/**
+ * @brief Entry point of the reactor threads.
+ *
+ * An error in a reactor stops the whole server, like it does on the main thread:
+ * the reactor threads block signals, so SIGINT is delivered to the main thread.
+ *
+ * @param arg The Reactor run by the thread.
+ * @return void* Always NULL.
+ */
+void* Server::_reactorThread(void* arg) {
+
+	Reactor* reactor = static_cast<Reactor*>(arg);
+	try {
+		reactor->server->_runReactor(*reactor);
+	} catch (const std::exception &e) {
+		Logger::error(MessageHandler::msgServerException(e));
+		kill(getpid(), SIGINT);
+	}
+	return NULL;
+}
+
+/**
+ * @brief Runs the event loop of a reactor.
+ *
+ * This function waits for ready descriptors through the poller of the reactor, accepts incoming client
+ * connections and handles client messages. Only the descriptors reported as ready are
+ * visited, so a wakeup costs O(ready) whatever the number of connected clients.
+ * Sockets are read and written without the server state lock: it is only taken to run
+ * commands, timers, and to register or delete clients.
+ * It also manages client deletion and handles exceptions.
+ *
+ * @param reactor The reactor to run, owned by the calling thread.
+ *
+ * @throws std::runtime_error If the poller fails.
+ */
+void Server::_runReactor(Reactor& reactor) {
+
+	// Les envois programmés depuis d'autres threads réveilleront ce reactor
+	reactor.flushList.setOwner(reactor.wakePipe[1]);
+
 	// Boucle infinie pour écouter les connexions des clients tant que le serveur n'est pas interrompu
 	while (1) {
 
-		if (signalReceived)
+		if (_stopRequested(reactor))
 			break;
 
-		// Copie temporaire de l'ensemble des descripteurs à surveiller pour la lecture (_readFds) pour select()
-		// qu'on réactualise à chaque itération de la boucle pour prendre en compte
-		// les nouvelles connexions / déconnexions
-		fd_set readFds = _readFds;
-
-		// Récupérer le descripteur maximum pour select()
-		// -> Si pas de client, ce sera le descripteur du serveur
-		// -> Sinon, ce sera le descripteur du client avec le plus grand descripteur
-		// 	qui se trouve a la fin de la map car celle-ci est automatiquement triée par ordre croissant
-		_maxFd = _getMaxFd();
-
-		// Délai pour la fonction select: intervalle de 500 ms pour le retour de fonction
-		struct timeval timeout = {0, 500000};
-
-		// Attendre que l'un des descripteurs soit prêt pour la lecture ou l'écriture
-		if (select(_maxFd + 1, &readFds, NULL, NULL, &timeout) < 0 && errno != EINTR)
-			throw std::runtime_error(ERR_SELECT_SOCKET);
-
-		// Envoi d'un PING à tous les clients inactifs pour vérifier leur connexion
-		_checkActivity();
-
-		// On parcourt tous les fds actifs.
-		// Si le fd est le fd du serveur : autre fd tente de se connecter,
-		// on accepte la nouvelle connexion et on cree un nouveau client.
-		// Sinon, le fd est deja client, donc on traite son message.
-		for (int fd = 0; fd <= _maxFd; fd++) {
-			if (signalReceived)
+		// Attendre que l'un des descripteurs soit prêt, au plus jusqu'à la prochaine échéance PING/PONG
+		// -> le poller ne remonte que les descripteurs prêts
+		if (reactor.poller->wait(reactor.readyEvents, _pollTimeout(reactor)) < 0)
+			throw std::runtime_error(ERR_POLL_SOCKET);
+
+		// On parcourt uniquement les fds prêts.
+		// Si le fd est un socket d'écoute : d'autres fds tentent de se connecter,
+		// on accepte toutes les nouvelles connexions et on cree les nouveaux clients.
+		// Sinon, le fd est deja client, donc on traite ses messages.
+		bool interactive = !reactor.backlog.empty();
+		for (std::vector<PollEvent>::iterator ev = reactor.readyEvents.begin(); ev != reactor.readyEvents.end(); ++ev) {
+			if (_stopRequested(reactor))
 				break;
-			if (FD_ISSET(fd, &readFds)) {
-				if (fd == _serverSocketFd)
-					_acceptNewClient();
-				else {
-					// On retrouve l'iterateur du client correspondant au fd dans la map _clients
-					std::map<int, Client*>::iterator it = _clients.find(fd);
-					_handleMessage(it);
-				}
-
+			if (ev->fd == reactor.listenFd) {
+				_acceptNewClients(reactor);
+				continue;
 			}
+			if (ev->fd == reactor.wakePipe[0]) {
+				reactor.drainWakePipe();
+				continue;
+			}
+			if (ev->fd == _signalPipe[0]) {
+				_drainWakeupPipe();
+				continue;
+			}
+
+			// On retrouve le client correspondant au fd parmi ceux du reactor
+			std::map<int, Client*>::iterator it = reactor.clients.find(ev->fd);
+			if (it == reactor.clients.end() || it->second->isLeaving())
+				continue;
+			interactive = true;
+			if (ev->events & poll_event::WRITE)
+				_flushClient(reactor, it->second);
+			// Un client du backlog attend son tour, même si de nouvelles données sont arrivées
+			if ((ev->events & poll_event::READ) && !it->second->isLeaving() && !it->second->isBacklogged())
+				_handleMessage(reactor, it->second);
 		}
 
+		// Suite des travaux bloquants terminés par le pool (fichiers DCC)
+		_runCompletions(reactor);
+
+		// Les clients dont le budget était épuisé reprennent leurs lignes, chacun son tour
+		_serveBacklog(reactor);
+
+		// Envoi d'un PING aux clients inactifs dont l'échéance est atteinte
+		_runTimers(reactor);
+
+		// Envoyer en une fois tous les messages produits pendant cette itération
+		// (y compris les derniers messages des clients sur le départ)
+		_flushPendingClients(reactor);
+
+		// Les copies de fichiers DCC passent après le chat : un morceau pour celles qui ont du débit
+		// (une seule si des clients ont été servis), puis l'annonce des copies terminées
+		if (_runTransfers(reactor, interactive))
+			_flushPendingClients(reactor);
+
 		// Supprimer les clients en attente de suppression
 		// (les supprimer au fur et à mesure dans la boucle ci-dessus impliquerait
 		// de modifier le conteneur pendant l'itération, ce qui causerait un comportement indéfini)
-		_lateClientDeletion();
+		_lateClientDeletion(reactor);
+	}
+}
+
+/**
+ * @brief Tells whether the loop of a reactor must stop.
+ *
+ * The main reactor stops on a signal, the other ones when _stopReactors() asks them to.
+ *
+ * @param reactor The reactor to check.
+ * @return bool True if the loop must stop.
+ */
+bool Server::_stopRequested(Reactor& reactor) const {
+	if (reactor.index == 0)
+		return signalReceived;
+	return reactor.stopRequested();
+}
+
+/**
+ * @brief Stops the reactor threads and waits for them.
+ *
+ * Safe to call several times: threads already joined are skipped.
+ */
+void Server::_stopReactors() {
+
+	for (size_t i = 1; i < _reactors.size(); ++i) {
+		if (!_reactors[i]->threadStarted)
+			continue;
+		_reactors[i]->requestStop();
+		pthread_join(_reactors[i]->thread, NULL);
+		_reactors[i]->threadStarted = false;
 	}
 }
 
@@ -558,32 +1194,60 @@ void Server::_start() {
  * @brief cleans the IRC server and closes all connections.
  *
  * This function closes all client objects and connections, frees memory,
- * and closes the server socket. It also ensures that all open file descriptors
- * are properly closed.
+ * and closes the listening sockets. It also ensures that all open file descriptors
+ * are properly closed. The reactor threads are stopped first, so nothing here needs
+ * the state lock.
  * Called in server destructor and signal handler.
  * 
  * @return void
  */
 void Server::_clean() {
 
-	// Fermer toutes connexions clients + objets clients + channels
-	while (!_clients.empty()) {
-		int clientFd = _clients.begin()->first;
-		Client* client = _clients.begin()->second;
+	// Plus aucun reactor ne confie de travail : le pool termine ceux en cours et s'arrête
+	_stopReactors();
+	_workers.stop();
 
+	// Fermer toutes connexions clients + objets clients + channels
+	for (std::map<int, Client*>::iterator it = _clients.begin(); it != _clients.end(); ++it) {
+		Client* client = it->second;
+		if (client->isLeaving())
+			continue;
+		client->setLeaving();
 		client->leaveAllChannels(_channels, SHUTDOWN_REASON, leaving_code::QUIT_SERV);
-		_disconnectClient(clientFd, SHUTDOWN_REASON);
+		_disconnectClient(it->first, SHUTDOWN_REASON);
+	}
+
+	// Dernière tentative d'envoi des messages en attente (ERROR de fermeture...)
+	for (size_t i = 0; i < _reactors.size(); ++i) {
+		_flushPendingClients(*_reactors[i]);
+		_reactors[i]->clientsToDelete.clear();
+		_reactors[i]->clients.clear();
+	}
+
+	while (!_clients.empty())
 		_deleteClient(_clients.begin());
+
+	// Fermer le self-pipe des signaux
+	for (int i = 0; i < 2; ++i) {
+		if (_signalPipe[i] >= 0) {
+			if (i == 0 && !_reactors.empty())
+				_reactors[0]->poller->remove(_signalPipe[0]);
+			close(_signalPipe[i]);
+			_signalPipe[i] = -1;
+		}
 	}
 
-	// Fermer le socket du serveur
-	if (close(_serverSocketFd) == -1) {
-		perror("Failed to close server socket");
-		return;
+	// Fermer les sockets d'écoute, les pollers et les pipes de réveil
+	for (size_t i = 0; i < _reactors.size(); ++i) {
+		_reactors[i]->poller->remove(_reactors[i]->listenFd);
+		delete _reactors[i];
 	}
+	_reactors.clear();
 
-	FD_ZERO(&_readFds);
-	std::cout << MessageHandler::msgBuilder(COLOR_SUCCESS, SERVER_SHUT_DOWN, eol::UNIX) << std::endl;
+	// Ecrit les derniers enregistrements, les messages suivants sont synchrones
+	// (le message de fin ne peut pas être perdu si le buffer de log est plein)
+	Logger::stop();
+	Logger::info(MessageHandler::msgBuilder(COLOR_SUCCESS, SERVER_SHUT_DOWN, eol::UNIX));
 }
 
 // === MESSAGES / COMMANDS ===
@@ -594,82 +1258,293 @@ void Server::_clean() {
  * This function receives messages from a client, processes them, and performs
  * necessary actions based on the received commands. It also manages client deletion
  * and handles exceptions.
+ * Called by the reactor that owns the client: the socket is read without the server state
+ * lock, which is only taken to run the complete lines received.
  *
- * @param it An iterator pointing to the client in the map of connected clients.
+ * A client only runs server::COMMANDS_PER_WAKEUP commands per loop iteration (see
+ * _processLines()). When its budget is spent, the rest of its lines stays in its input
+ * buffer, the socket is no longer read (the kernel buffer fills up and TCP slows the
+ * sender down) and the client joins the reactor backlog: it is served again at the next
+ * iteration, after the clients that just became ready, in turn with the other clients
+ * of the backlog. A client pipelining thousands of commands (PINGs included, see
+ * _processLines()) can no longer hold the loop.
+ *
+ * @param reactor The reactor that owns the client.
+ * @param client The client whose socket is readable (or whose turn came in the backlog).
  *
  * @return void
  *
  * @throws std::exception If an error occurs while processing the client's message.
  */
-void Server::_handleMessage(std::map<int, Client*>::iterator it) {
+void Server::_handleMessage(Reactor& reactor, Client* client) {
 
-	int clientFd = it->first;
-	Client* client = it->second;
+	int clientFd = client->getFd();
+	size_t budget = server::COMMANDS_PER_WAKEUP;
+	size_t priority = server::PRIORITY_PER_WAKEUP;
+
+	// recv() écrit directement dans le buffer d'entrée du client
+	InputBuffer& input = client->getInputBuffer();
+
+	// Lignes laissées au tour précédent : elles passent avant une nouvelle lecture du socket
+	if (client->isBacklogged()) {
+		client->setBacklogged(false);
+		if (!_processLines(client, budget, priority)) {
+			_backlogClient(reactor, client);
+			return;
+		}
+	}
+
+	// Le poller est edge-triggered : on lit jusqu'à ce que le socket soit vide,
+	// sinon les données restantes ne seraient plus jamais signalées
+	// (ou jusqu'à épuisement du budget : le backlog nous ramènera ici)
+	while (!client->isLeaving()) {
+
+		size_t available;
+		char* dest = input.prepareWrite(available);
+		ssize_t bytesRead = recv(clientFd, dest, available, 0);
+
+		if (bytesRead < 0) {
+			if (errno == EINTR)
+				continue;
+			// Plus rien à lire pour l'instant
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				break;
+			// Erreur de lecture (connexion réinitialisée...)
+			Logger::error(MessageHandler::msgSystemError("Failed to read from client", errno));
+			_dropClient(clientFd, CLIENT_CLOSED_CONNECTION);
+			return;
+		}
+		if (bytesRead == 0) {
+			// Client déconnecté proprement
+			_dropClient(clientFd, CLIENT_CLOSED_CONNECTION);
+			return;
+		}
+		input.commitWrite(bytesRead);
+
+		// Budget épuisé : le reste (buffer et socket) attend le prochain tour
+		if (!_processLines(client, budget, priority)) {
+			_backlogClient(reactor, client);
+			return;
+		}
+
+		// Lecture incomplète : le socket est vide, inutile de rappeler recv() pour obtenir EAGAIN
+		if (static_cast<size_t>(bytesRead) < available)
+			break;
+	}
+
+	// S'il reste un message dans le buffer c'est because CTRL+D
+	// On l'a déjà stocké dans le buffer, ça sera traité la fois suivante
+	if (!client->isLeaving() && input.pending() > 0 && input.pending() < server::BUFFER_SIZE - 1)
+		client->sendMessage("^D", NULL);
+}
+
+/**
+ * @brief Runs the complete lines buffered for a client, within its budget.
+ *
+ * Each line is a view into the input buffer, run without copy under the server state
+ * lock. Every command costs one unit of `budget`, except the first
+ * server::PRIORITY_PER_WAKEUP PING and PONG: this priority lane keeps the lag checks of
+ * a busy client (and its answers to our PINGs) from waiting behind its own backlog.
+ * The lane is small, the next PINGs count like any command: a stream of PINGs can't
+ * hold the loop either. The lines are always run in the order they were received, a
+ * PING still answers after the commands sent before it.
+ *
+ * @param client The client whose lines are run.
+ * @param budget The number of commands the client may still run in this iteration.
+ * @param priority The number of PING / PONG still free in this iteration.
+ * @return bool False if the budget ran out while complete lines were left in the buffer.
+ */
+bool Server::_processLines(Client* client, size_t& budget, size_t& priority) {
+
+	InputBuffer& input = client->getInputBuffer();
+
+	// Les commandes modifient l'état partagé entre les reactors (clients, canaux...)
+	MutexLock lock(_stateLock);
+	std::map<int, Client*>::iterator it = _clients.find(client->getFd());
 	client->setLastActivity();
 
-	char currentBuffer[server::BUFFER_SIZE];
-	std::memset(currentBuffer, 0, sizeof(currentBuffer));
-	ssize_t bytesRead = recv(clientFd, currentBuffer, sizeof(currentBuffer) - 1, 0);
+	// On traite chaque ligne complète, sans copie : (pointeur, longueur) dans le buffer
+	// (on s'arrête si une commande a fait quitter le client, ex: QUIT)
+	const char* line;
+	size_t length;
+	while (!client->isLeaving() && input.peekLine(line, length)) {
+
+		bool free = priority > 0 && _isPriorityLine(line, length);
+		if (budget == 0 && !free)
+			return false;
+		input.nextLine(line, length);
+		if (free)
+			--priority;
+		else
+			--budget;
+
+		// Debug : affiche le message reçu (IRCSERV_LOG_LEVEL=verbose)
+		if (Logger::enabled(log_level::VERBOSE))
+			Logger::verbose("---> " + std::string(line, length));
+
+		_processInput(it, line, length);
+	}
 
-	if (bytesRead < 0) {
-		// Erreur de lecture
-		perror("Failed to read from client");
-		return;
+	// Ligne sans fin démesurée : on la jette plutôt que de la garder en mémoire
+	if (input.pending() > server::INPUT_LINE_MAX) {
+		input.clear();
+		client->sendMessage(MessageHandler::ircLineTooLong(client->isAuthenticated() ? client->getNickname() : "*"), NULL);
 	}
-	if (bytesRead == 0) {
-		// Client déconnecté proprement
-		prepareClientToLeave(it, CLIENT_CLOSED_CONNECTION);
-		return;
+	return true;
+}
+
+/**
+ * @brief Tells whether a line is a PING or a PONG (priority lane, see _processLines()).
+ *
+ * Only the command name is looked at, case-insensitively, after an optional prefix:
+ * the line is parsed for good by the CommandHandler.
+ *
+ * @param line The first byte of the line.
+ * @param length The length of the line.
+ * @return bool True for PING and PONG.
+ */
+bool Server::_isPriorityLine(const char* line, size_t length) {
+
+	size_t pos = 0;
+	if (length > 0 && line[0] == ':') {
+		while (pos < length && line[pos] != ' ')
+			++pos;
+		while (pos < length && line[pos] == ' ')
+			++pos;
 	}
-	currentBuffer[bytesRead] = '\0';
+	size_t end = pos;
+	while (end < length && line[end] != ' ')
+		++end;
 
-	// On récupère le message stocké dans le buffer du client
-	std::string& bufferMessage = client->getBufferMessage();
+	StringView command(line + pos, end - pos);
+	return command.compareUpper(commands::PING.c_str()) == 0 || command.compareUpper(commands::PONG.c_str()) == 0;
+}
 
-	// Ajoute les nouvelles données reçues au buffer existant
-	bufferMessage.append(currentBuffer);
+/**
+ * @brief Puts a client whose budget ran out at the end of the reactor backlog.
+ *
+ * @param reactor The reactor that owns the client.
+ * @param client The client that still has input to run.
+ */
+void Server::_backlogClient(Reactor& reactor, Client* client) {
+	if (client->isBacklogged() || client->isLeaving())
+		return;
+	client->setBacklogged(true);
+	reactor.backlog.push_back(client->getFd());
+}
 
-	// On parcourt les messages tant qu'il y a un \n
-	size_t pos;
-	while (((pos = bufferMessage.find('\n')) != std::string::npos)) {
+/**
+ * @brief Gives their turn to the clients of the backlog (round robin).
+ *
+ * Called once per loop iteration, after the ready descriptors: each backlogged client
+ * runs one more budget of commands. The ones that still have input go back to the end
+ * of the backlog, for the next iteration (the poller then doesn't wait, see _pollTimeout()).
+ * A client that left in the meantime (or whose fd now belongs to a new connection, that
+ * is not backlogged) is skipped.
+ *
+ * @param reactor The reactor whose backlog is served.
+ */
+void Server::_serveBacklog(Reactor& reactor) {
 
-		// On extrait le message jusqu'au \n (non inclus)
-		std::string message = bufferMessage.substr(0, pos);
+	if (reactor.backlog.empty())
+		return;
+	reactor.backlogRound.swap(reactor.backlog);
 
-		// On enlève le \r s'il y en a un (cas irssi)
-		if (!message.empty() && message[message.size() - 1] == '\r')
-			message.erase(message.size() - 1);
+	for (size_t i = 0; i < reactor.backlogRound.size(); ++i) {
+		if (_stopRequested(reactor))
+			break;
+		std::map<int, Client*>::iterator it = reactor.clients.find(reactor.backlogRound[i]);
+		if (it == reactor.clients.end() || !it->second->isBacklogged() || it->second->isLeaving())
+			continue;
+		_handleMessage(reactor, it->second);
+	}
+	reactor.backlogRound.clear();
+}
 
-		// On supprime la commande traitée du buffer
-		bufferMessage.erase(0, pos + 1);
+/**
+ * @brief Writes the pending messages of a client.
+ *
+ * - Queue drained: the client is no longer watched for writability.
+ * - Socket full (EAGAIN): the client is watched for writability, the poller will
+ *   wake us up when the kernel buffer has room again.
+ * - Write error, or send queue limit exceeded (client too slow): the client is disconnected.
+ *
+ * A client that is already leaving only gets a best effort write, it is closed
+ * at the end of the loop iteration whatever happens.
+ * Only the reactor that owns the client writes to its socket, without the server state lock.
+ *
+ * @param reactor The reactor that owns the client.
+ * @param client The client to flush.
+ */
+void Server::_flushClient(Reactor& reactor, Client* client) {
 
-		// Debug : affiche le message reçu
-		// std::cout << "---> " << message << std::endl;
+	int clientFd = client->getFd();
 
-		// On traite le message extrait,
-		// le reste sera traité à la prochaine itération
-		_processInput(it, message);
+	if (client->sendQueueOverflowed()) {
+		client->flushSendQueue();
+		if (!client->isLeaving())
+			_dropClient(clientFd, SENDQ_EXCEEDED);
+		return;
 	}
 
-	// S'il reste un message dans le buffer c'est because CTRL+D
-	// On l'a déjà stocké dans le buffer, ça sera traité la fois suivante
-	if (!bufferMessage.empty() && bufferMessage.size() < server::BUFFER_SIZE - 1)
-		client->sendMessage("^D", NULL);
+	switch (client->flushSendQueue()) {
+		case SendQueue::FLUSH_DONE:
+			if (client->isWaitingWritable()) {
+				client->setWaitingWritable(false);
+				if (!client->isLeaving())
+					reactor.poller->modify(clientFd, poll_event::READ);
+			}
+			break;
+		case SendQueue::FLUSH_PENDING:
+			if (!client->isWaitingWritable() && !client->isLeaving()) {
+				client->setWaitingWritable(true);
+				reactor.poller->modify(clientFd, poll_event::READ | poll_event::WRITE);
+			}
+			break;
+		case SendQueue::FLUSH_ERROR:
+			if (!client->isLeaving())
+				_dropClient(clientFd, CLIENT_CLOSED_CONNECTION);
+			break;
+	}
+}
+
+/**
+ * @brief Writes the pending messages of every client scheduled for a flush.
+ *
+ * Called once per loop iteration: all the lines produced for a client while handling
+ * the ready descriptors leave in a single system call. Flushing a client may schedule
+ * other ones (e.g. a QUIT broadcast when a client is disconnected), so the list is
+ * taken again until it is empty.
+ * Other reactors may have pushed clients that left (or whose fd now belongs to a new
+ * connection) in the meantime: only the clients still owned by this reactor are flushed.
+ *
+ * @param reactor The reactor whose flush list is processed.
+ */
+void Server::_flushPendingClients(Reactor& reactor) {
+
+	while (reactor.flushList.take(reactor.flushing)) {
+		for (size_t i = 0; i < reactor.flushing.size(); ++i) {
+			std::map<int, Client*>::iterator it = reactor.clients.find(reactor.flushing[i]);
+			if (it != reactor.clients.end())
+				_flushClient(reactor, it->second);
+		}
+	}
 }
 
 /**
  * @brief Processes the input message from a client.
  *
- * This function takes an iterator to a map of clients and a message string,
+ * This function takes an iterator to a map of clients and a line view,
  * and processes the input message from the client associated with the iterator.
  * It creates a CommandHandler object to manage the command contained in the message.
  * If an exception is thrown during command management, the exception message is sent
  * back to the client.
  *
  * @param it Iterator to a map of clients, where the key is an integer and the value is a pointer to a Client object.
- * @param message The input message from the client to be processed.
+ * @param line The first byte of the line, inside the client input buffer.
+ * @param length The length of the line (without \r\n).
  */
-void Server::_processInput(std::map<int, Client*>::iterator it, std::string message) {
+void Server::_processInput(std::map<int, Client*>::iterator it, const char* line, size_t length) {
 
 	Client* client = it->second;
 	if (client->errorMsgTooLongSent() == true)
@@ -677,7 +1552,7 @@ void Server::_processInput(std::map<int, Client*>::iterator it, std::string mess
 
 	try {
 		CommandHandler handler(*this, it);
-		handler.manage_command(message);
+		handler.manage_command(line, length);
 	} catch (const std::exception &e) {
 		client->sendMessage(e.what(), NULL);
 	}
@@ -687,82 +1562,135 @@ void Server::_processInput(std::map<int, Client*>::iterator it, std::string mess
 // === UPDATE CLIENTS ===
 
 /**
- * @brief Accepts a new client connection to the server.
+ * @brief Accepts every pending client connection.
  *
- * This function handles the acceptance of a new client connection. It performs the following steps:
- * 1. Initializes a sockaddr_in structure to store the client's address.
- * 2. Accepts a new connection and obtains a new socket descriptor for the client.
- * 3. Sets the new client socket to non-blocking mode.
- * 4. Adds the new client to the list of connected clients.
- * 5. Retrieves and stores the client's address.
- * 6. Converts the client's binary address to a readable string format.
- * 7. Sets the client's hostname or defaults to "127.0.0.1" if unavailable.
- * 8. Adds the client's socket descriptor to the set of descriptors monitored for reading.
- * 9. Sets the start of the client's activity.
- * 10. Prompts the client to enter authentication information.
- * 11. Outputs a debug message indicating the client has connected.
+ * The listening socket is watched in edge-triggered mode, so a single readiness
+ * notification may stand for several connections: accept() is called until it
+ * reports EAGAIN. The accepted clients belong to the reactor that accepted them.
  *
- * @note This function uses perror to print error messages if any system call fails.
+ * @param reactor The reactor whose listening socket is ready.
  */
-void Server::_acceptNewClient() {
+void Server::_acceptNewClients(Reactor& reactor) {
+
+	while (!_stopRequested(reactor)) {
+
+		// Structure pour récupérer l'adresse du client qui se connecte
+		struct sockaddr_in clientAddr;
+		socklen_t clientAddrLen = sizeof(clientAddr);
+
+		// Accepter une connexion et obtenir un nouveau descripteur de socket pour ce client
+		int newClientFd = accept(reactor.listenFd, (struct sockaddr*)&clientAddr, &clientAddrLen);
+		if (newClientFd < 0) {
+			if (errno == EINTR)
+				continue;
+			// Plus de connexion en attente
+			if (errno != EAGAIN && errno != EWOULDBLOCK)
+				Logger::error(MessageHandler::msgSystemError("Failed to accept new client", errno));
+			return;
+		}
+		_acceptNewClient(reactor, newClientFd);
+	}
+}
+
+/**
+ * @brief Registers a new client connection to the server.
+ *
+ * This function handles the registration of a freshly accepted connection. It performs the following steps:
+ * 1. Sets the new client socket to non-blocking mode.
+ * 2. Registers the socket with the poller of the reactor (the select() backend refuses fds >= FD_SETSIZE).
+ * 3. Adds the new client to the list of connected clients and to the clients of the reactor.
+ * 4. Retrieves and stores the client's address.
+ * 5. Converts the client's binary address to a readable string format.
+ * 6. Sets the client's hostname or defaults to "127.0.0.1" if unavailable.
+ * 7. Prompts the client to enter authentication information.
+ * 8. Outputs a debug message indicating the client has connected.
+ *
+ * @param reactor The reactor that accepted the connection, and now owns it.
+ * @param newClientFd The socket returned by accept().
+ *
+ * @note System call failures are logged at error level.
+ */
+void Server::_acceptNewClient(Reactor& reactor, int newClientFd) {
 
-	// Structure pour récupérer l'adresse du client qui se connecte
 	struct sockaddr_in clientAddr;
 	socklen_t clientAddrLen = sizeof(clientAddr);
 
-	// Accepter une connexion et obtenir un nouveau descripteur de socket pour ce client
-	int newClientFd = accept(_serverSocketFd, (struct sockaddr*)&clientAddr, &clientAddrLen);
-	if (newClientFd < 0) {
-		perror("Failed to accept new client");
+	// Rendre le nouveau socket non-bloquant
+	if (fcntl(newClientFd, F_SETFL, O_NONBLOCK) < 0) {
+		Logger::error(MessageHandler::msgSystemError("Failed to set client socket to non-blocking", errno));
+		close(newClientFd);
 		return;
 	}
 
-	// Rendre le nouveau socket non-bloquant
-	if (fcntl(newClientFd, F_SETFL, O_NONBLOCK) < 0) {
-		perror("Failed to set client socket to non-blocking");
-		_disconnectClient(newClientFd, CONNECTION_FAILED);
+	// Ajouter le descripteur du client au poller du reactor pour la lecture
+	if (!reactor.poller->add(newClientFd, poll_event::READ)) {
+		Logger::error(MessageHandler::msgSystemError("Failed to watch client socket", errno));
+		close(newClientFd);
 		return;
 	}
 
+	MutexLock lock(_stateLock);
+
 	// Ajouter ce nouveau client à la liste des clients connectés
-	_clients[newClientFd] = new Client(newClientFd);
+	unsigned long clientId = ++_nextClientId;
+	Client* client = new Client(newClientFd, clientId);
+	_clients[newClientFd] = client;
+	reactor.clients[newClientFd] = client;
+	client->setReactor(reactor.index, &reactor.flushList);
+
+	// Première vérification d'activité à la fin du délai d'inactivité
+	reactor.timers.schedule(time(NULL) + server::PING_INTERVAL + 1, newClientFd, clientId);
 
 	// Si l'adresse et le port du client ne sont pas récupérables (ex: proxy, VPN...)
 	// on assigne des valeurs par défaut pour éviter une déconnexion
 	if (getpeername(newClientFd, (struct sockaddr*)&clientAddr, &clientAddrLen) == -1) {
-		_clients[newClientFd]->setClientIp(server::UNKNOWN_IP);
-		_clients[newClientFd]->setClientPort(0);
+		client->setClientIp(server::UNKNOWN_IP);
+		client->setClientPort(0);
 	} else {
 		// Buffer pour stocker l'adresse IP du client (NI_MAXHOST garantit une taille suffisante)
 		char ipAddr[NI_MAXHOST];
 	
 		// Convertit l'adresse binaire en chaîne lisible
 		if (getnameinfo((struct sockaddr*)&clientAddr, clientAddrLen, ipAddr, sizeof(ipAddr), NULL, 0, NI_NUMERICHOST) != 0) {
-			_clients[newClientFd]->setClientIp(server::UNKNOWN_IP);
+			client->setClientIp(server::UNKNOWN_IP);
 		} else
-			_clients[newClientFd]->setClientIp(ipAddr);
+			client->setClientIp(ipAddr);
 	
 		// Stocke le port source du client (0 si non identifiable)
 		int clientPort = ntohs(((struct sockaddr_in*)&clientAddr)->sin_port);
-		_clients[newClientFd]->setClientPort(clientPort);
+		client->setClientPort(clientPort);
 	}
 
-	// Ajouter le descripteur du client à l'ensemble des descripteurs surveillés pour l'écriture et la lecture
-	FD_SET(newClientFd, &_readFds);
-
 	// Prompt pour saisir les infos d'authentification
-	std::string authenticationPrompt = IrcHelper::commandToSend(*_clients[newClientFd]);
-	_clients[newClientFd]->sendMessage(MessageHandler::ircCommandPrompt(authenticationPrompt, "", false), NULL);
+	std::string authenticationPrompt = IrcHelper::commandToSend(*client);
+	client->sendMessage(MessageHandler::ircCommandPrompt(authenticationPrompt, "", false), NULL);
 
 	// Log de connexion du client
-	std::cout << MessageHandler::msgClientConnected(_clients[newClientFd]->getClientIp(), _clients[newClientFd]->getClientPort(), newClientFd, "") << std::endl;
+	Logger::info(MessageHandler::msgClientConnected(client->getClientIp(), client->getClientPort(), newClientFd, ""));
+}
+
+/**
+ * @brief Makes a client leave from the I/O path of its reactor (read or write error, sendq exceeded).
+ *
+ * Unlike prepareClientToLeave(), the server state is not locked by the caller.
+ *
+ * @param fd The client socket.
+ * @param reason The quit reason broadcast to the channels.
+ */
+void Server::_dropClient(int fd, const std::string& reason) {
+	MutexLock lock(_stateLock);
+	std::map<int, Client*>::iterator it = _clients.find(fd);
+	if (it != _clients.end())
+		prepareClientToLeave(it, reason);
 }
 
 /**
  * @brief Disconnects a client from the server.
  *
- * This function removes the client's socket from the set of descriptors to monitor,
- * closes the client's socket, and prints a message indicating the successful disconnection.
+ * This function removes the client's socket from the descriptors watched by the poller
+ * and prints a message indicating the successful disconnection.
+ * The socket itself is closed in _deleteClient(): until the client object is deleted,
+ * the kernel must not be able to hand the same fd number to a new connection.
  *
  * @param fd The file descriptor of the client to disconnect.
  *
@@ -773,24 +1701,20 @@ void Server::_disconnectClient(int fd, const std::string& reason) {
 	if (reason == SHUTDOWN_REASON || reason == CONNECTION_TIMEOUT || reason == CONNECTION_FAILED)
 		_clients[fd]->sendMessage(MessageHandler::ircErrorQuitServer(reason), NULL);
 
-	// Retirer le socket du client des descripteurs à surveiller
-	FD_CLR(fd, &_readFds);
-
-	// Fermer le socket du client
-	if (close(fd) == -1) {
-		perror("Failed to close client socket");
-		return;
-	}
+	// Retirer le socket du client des descripteurs à surveiller par son reactor
+	_reactors[_clients[fd]->getReactorIndex()]->poller->remove(fd);
 
 	std::string nick = _clients[fd]->isAuthenticated() ? _clients[fd]->getNickname() : "";
-	std::cout << MessageHandler::msgClientDisconnected(_clients[fd]->getClientIp(), _clients[fd]->getClientPort(), fd, nick) << std::endl;
+	Logger::info(MessageHandler::msgClientDisconnected(_clients[fd]->getClientIp(), _clients[fd]->getClientPort(), fd, nick));
 }
 
 /**
  * @brief Deletes a client from the connected clients list.
  *
- * This function removes a client from the map of connected clients and deletes the associated
- * client object. It also closes the client's socket connection.
+ * This function closes the client's socket connection, removes the client from the map
+ * of connected clients and deletes the associated client object. Its pending channel
+ * invitations are dropped first, looking up only the channels it was invited to, and
+ * so are its pending DCC offers.
  *
  * @param it An iterator pointing to the client in the map of connected clients.
  *
@@ -798,6 +1722,24 @@ void Server::_disconnectClient(int fd, const std::string& reason) {
  */
 void Server::_deleteClient(std::map<int, Client*>::iterator it) {
 	if (it != _clients.end()) {
+		// Libérer son pseudo
+		_nicknames.remove(it->second->getNickname(), it->second);
+		if (it->second->isAuthenticated())
+			--_registeredCount;
+
+		// Oublier ses invitations : l'adresse du client sera réutilisée par le pool
+		const std::vector<std::string>& invited = it->second->getInvitedChannels();
+		for (size_t i = 0; i < invited.size(); ++i) {
+			std::map<std::string, Channel*>::iterator channel = _channels.find(invited[i]);
+			if (channel != _channels.end())
+				channel->second->forgetClient(it->second);
+		}
+		// Ses offres DCC partent avec la connexion (quota compté sur son numéro)
+		_offers.removeSender(it->second->getId());
+
+		// Fermer le socket du client
+		if (close(it->first) == -1)
+			Logger::error(MessageHandler::msgSystemError("Failed to close client socket", errno));
 		delete it->second; // Supprime l'objet client
 		_clients.erase(it->first); // Supprime l'entrée du client dans map
 	}
@@ -806,11 +1748,22 @@ void Server::_deleteClient(std::map<int, Client*>::iterator it) {
 /**
  * @brief Deletes clients marked for deletion.
  * 
- * This function iterates through the list of clients that are marked for deletion,
+ * This function iterates through the list of clients of a reactor that are marked for deletion,
  * deletes each one. After all clients are deleted, the list is cleared.
+ * The server state is only locked when a client is actually waiting: the list is only
+ * filled by the thread of the reactor (QUIT, ping timeout, I/O errors of its clients),
+ * so it can be checked without the lock.
+ *
+ * @param reactor The reactor that owns the clients to delete.
  */
-void Server::_lateClientDeletion() {
-	for (std::vector<std::map<int, Client*>::iterator>::iterator it = _clientsToDelete.begin(); it != _clientsToDelete.end(); ++it)
+void Server::_lateClientDeletion(Reactor& reactor) {
+	if (reactor.clientsToDelete.empty())
+		return;
+
+	MutexLock lock(_stateLock);
+	for (std::vector<std::map<int, Client*>::iterator>::iterator it = reactor.clientsToDelete.begin(); it != reactor.clientsToDelete.end(); ++it) {
+		reactor.clients.erase((*it)->first);
 		_deleteClient(*it);
-	_clientsToDelete.clear();
+	}
+	reactor.clientsToDelete.clear();
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "../../incs/classes/SharedBuffer.hpp"
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+SharedBuffer::SharedBuffer() : _block(NULL) {}
+
+SharedBuffer::SharedBuffer(const std::string& data) : _block(NULL) {
+	if (data.empty())
+		return;
+	_block = new Block;
+	_block->refs = 1;
+	_block->data = data;
+}
+
+SharedBuffer::SharedBuffer(const SharedBuffer& src) : _block(src._block) {
+	if (_block)
+		__atomic_fetch_add(&_block->refs, 1, __ATOMIC_RELAXED);
+}
+
+SharedBuffer& SharedBuffer::operator=(const SharedBuffer& src) {
+	if (_block != src._block) {
+		// On prend la nouvelle référence avant de lâcher l'ancienne
+		if (src._block)
+			__atomic_fetch_add(&src._block->refs, 1, __ATOMIC_RELAXED);
+		_release();
+		_block = src._block;
+	}
+	return *this;
+}
+
+SharedBuffer::~SharedBuffer() {
+	_release();
+}
+
+/**
+ * @brief Builds a buffer from a freshly formatted line, without copying its bytes.
+ *
+ * The string is swapped into the shared block: the line built by the reply formatter
+ * is the one queued to the clients. `data` is left empty.
+ */
+SharedBuffer SharedBuffer::adopt(std::string& data) {
+	SharedBuffer buffer;
+	if (data.empty())
+		return buffer;
+	buffer._block = new Block;
+	buffer._block->refs = 1;
+	buffer._block->data.swap(data);
+	return buffer;
+}
+
+void SharedBuffer::_release() {
+	if (_block && __atomic_sub_fetch(&_block->refs, 1, __ATOMIC_ACQ_REL) == 0)
+		delete _block;
+	_block = NULL;
+}
+
+
+// === GETTERS ===
+
+const char* SharedBuffer::data() const {
+	return _block ? _block->data.data() : "";
+}
+size_t SharedBuffer::size() const {
+	return _block ? _block->data.size() : 0;
+}
+bool SharedBuffer::empty() const {
+	return _block == NULL;
+}
+int SharedBuffer::useCount() const {
+	return _block ? __atomic_load_n(&_block->refs, __ATOMIC_RELAXED) : 0;
+}
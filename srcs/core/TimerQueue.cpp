@@ -0,0 +1,65 @@
+#include "../../incs/classes/TimerQueue.hpp"
+
+#include <algorithm>			// push_heap(), pop_heap()
+
+// =========================================================================================
+
+namespace {
+	// std::*_heap construisent un tas max : on inverse la comparaison pour avoir le plus proche en tête
+	struct LaterDeadline {
+		bool operator()(const Timer& a, const Timer& b) const {
+			return a.deadline > b.deadline;
+		}
+	};
+}
+
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+// --- PUBLIC
+TimerQueue::TimerQueue() {}
+TimerQueue::~TimerQueue() {}
+
+// --- PRIVATE
+TimerQueue::TimerQueue(const TimerQueue& src) {(void) src;}
+TimerQueue& TimerQueue::operator=(const TimerQueue& src) {(void) src; return *this;}
+
+
+// === TIMERS ===
+
+void TimerQueue::schedule(time_t deadline, int fd, unsigned long id) {
+	Timer timer;
+	timer.deadline = deadline;
+	timer.fd = fd;
+	timer.id = id;
+	_heap.push_back(timer);
+	std::push_heap(_heap.begin(), _heap.end(), LaterDeadline());
+}
+
+/**
+ * @brief Removes the earliest timer if its deadline is reached.
+ *
+ * @param now The current time.
+ * @param timer Filled with the expired timer.
+ * @return true if a timer expired, false if the earliest deadline is still in the future.
+ */
+bool TimerQueue::popExpired(time_t now, Timer& timer) {
+	if (_heap.empty() || _heap.front().deadline > now)
+		return false;
+	std::pop_heap(_heap.begin(), _heap.end(), LaterDeadline());
+	timer = _heap.back();
+	_heap.pop_back();
+	return true;
+}
+
+bool TimerQueue::empty() const {
+	return _heap.empty();
+}
+time_t TimerQueue::nextDeadline() const {
+	return _heap.front().deadline;
+}
+size_t TimerQueue::size() const {
+	return _heap.size();
+}
+void TimerQueue::clear() {
+	_heap.clear();
+}
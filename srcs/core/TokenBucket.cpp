@@ -0,0 +1,61 @@
+#include "../../incs/classes/TokenBucket.hpp"
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+// --- PUBLIC
+// La réserve démarre pleine : une copie commence sans attendre
+TokenBucket::TokenBucket(size_t rate, size_t burst)
+	: _rate(static_cast<double>(rate)), _burst(static_cast<double>(burst)), _tokens(static_cast<double>(burst)), _last(0) {}
+TokenBucket::~TokenBucket() {}
+
+// --- PRIVATE
+TokenBucket::TokenBucket() {}
+
+
+// === TOKENS ===
+
+/**
+ * @brief Refills the bucket for the time elapsed since the last call.
+ *
+ * @param now The current time, in microseconds (CommandStats::now()).
+ * @return size_t The bytes that may be used now, (size_t)-1 if the rate isn't limited.
+ */
+size_t TokenBucket::available(unsigned long now) {
+	if (!limited())
+		return static_cast<size_t>(-1);
+	if (_last != 0 && now > _last) {
+		_tokens += _rate * static_cast<double>(now - _last) / 1000000.0;
+		if (_tokens > _burst)
+			_tokens = _burst;
+	}
+	_last = now;
+	return static_cast<size_t>(_tokens);
+}
+
+void TokenBucket::consume(size_t bytes) {
+	if (!limited())
+		return;
+	_tokens -= static_cast<double>(bytes);
+	if (_tokens < 0)
+		_tokens = 0;
+}
+
+/**
+ * @brief Tells how long to wait before `bytes` bytes are available.
+ *
+ * @param bytes The bytes needed (capped at the burst: more would never be available).
+ * @return unsigned long The delay in microseconds, 0 if they already are.
+ */
+unsigned long TokenBucket::delay(size_t bytes) const {
+	if (!limited())
+		return 0;
+	double needed = static_cast<double>(bytes) < _burst ? static_cast<double>(bytes) : _burst;
+	if (_tokens >= needed)
+		return 0;
+	return static_cast<unsigned long>((needed - _tokens) * 1000000.0 / _rate) + 1;
+}
+
+bool TokenBucket::limited() const {
+	return _rate > 0;
+}
@@ -0,0 +1,172 @@
+#include "../../incs/classes/WorkerPool.hpp"
+
+#include <unistd.h>				// write()
+
+// =========================================================================================
+// === WORKER JOB ===
+
+// --- PUBLIC
+WorkerJob::WorkerJob() : _next(NULL), _completions(NULL) {}
+WorkerJob::~WorkerJob() {}
+
+// --- PRIVATE
+WorkerJob::WorkerJob(const WorkerJob& src) {(void) src;}
+WorkerJob& WorkerJob::operator=(const WorkerJob& src) {(void) src; return *this;}
+
+
+// =========================================================================================
+// === COMPLETION QUEUE ===
+
+// --- PUBLIC
+CompletionQueue::CompletionQueue() : _head(NULL), _wakeFd(-1) {}
+
+// Les travaux terminés mais jamais repris (arrêt du serveur) sont supprimés
+CompletionQueue::~CompletionQueue() {
+	WorkerJob* job = take();
+	while (job) {
+		WorkerJob* following = job->_next;
+		delete job;
+		job = following;
+	}
+}
+
+// --- PRIVATE
+CompletionQueue::CompletionQueue(const CompletionQueue& src) {(void) src;}
+CompletionQueue& CompletionQueue::operator=(const CompletionQueue& src) {(void) src; return *this;}
+
+void CompletionQueue::setWakeFd(int wakeFd) {
+	_wakeFd = wakeFd;
+}
+
+/**
+ * @brief Adds a finished job, from any thread, without lock.
+ *
+ * The release ordering publishes what run() wrote to the reactor, which takes the list
+ * with an acquire exchange. Only the push on an empty list wakes the reactor up: the
+ * following ones will be taken by the same take().
+ *
+ * @param job The finished job.
+ */
+void CompletionQueue::push(WorkerJob* job) {
+	WorkerJob* head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+	do {
+		job->_next = head;
+	} while (!__atomic_compare_exchange_n(&_head, &head, job, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+	// Pipe plein : le reactor a déjà un réveil en attente
+	if (head == NULL && _wakeFd >= 0) {
+		if (write(_wakeFd, "!", 1) < 0) {}
+	}
+}
+
+/**
+ * @brief Takes every finished job, the queue is left empty.
+ *
+ * @return WorkerJob* The first finished job (follow with next()), NULL if none.
+ */
+WorkerJob* CompletionQueue::take() {
+	WorkerJob* job = __atomic_exchange_n(&_head, static_cast<WorkerJob*>(NULL), __ATOMIC_ACQUIRE);
+
+	// La pile est dans l'ordre inverse des fins : on la retourne
+	WorkerJob* ordered = NULL;
+	while (job) {
+		WorkerJob* following = job->_next;
+		job->_next = ordered;
+		ordered = job;
+		job = following;
+	}
+	return ordered;
+}
+
+WorkerJob* CompletionQueue::next(const WorkerJob* job) {
+	return job->_next;
+}
+
+
+// =========================================================================================
+// === WORKER POOL ===
+
+// --- PUBLIC
+WorkerPool::WorkerPool() : _stopping(false) {}
+WorkerPool::~WorkerPool() {
+	stop();
+}
+
+// --- PRIVATE
+WorkerPool::WorkerPool(const WorkerPool& src) {(void) src;}
+WorkerPool& WorkerPool::operator=(const WorkerPool& src) {(void) src; return *this;}
+
+/**
+ * @brief Starts the threads of the pool.
+ *
+ * The threads inherit the signal mask of the caller: the server starts them with its
+ * signals blocked, like the reactor threads.
+ *
+ * @param count The number of threads. If none can be created, the jobs run inline.
+ */
+void WorkerPool::start(size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		pthread_t thread;
+		if (pthread_create(&thread, NULL, &WorkerPool::_work, this) != 0)
+			break;
+		_threads.push_back(thread);
+	}
+}
+
+/**
+ * @brief Stops the threads once the jobs they run are over.
+ *
+ * The jobs still waiting for a thread are deleted without being run. Safe to call
+ * several times.
+ */
+void WorkerPool::stop() {
+	{
+		MutexLock lock(_lock);
+		_stopping = true;
+		_ready.broadcast();
+	}
+	for (size_t i = 0; i < _threads.size(); ++i)
+		pthread_join(_threads[i], NULL);
+	_threads.clear();
+
+	for (size_t i = 0; i < _jobs.size(); ++i)
+		delete _jobs[i];
+	_jobs.clear();
+}
+
+/**
+ * @brief Hands a job to the pool.
+ *
+ * @param job The job, owned by the pool, then by `completions`, until it is deleted.
+ * @param completions The queue of the reactor waiting for the end of the job.
+ */
+void WorkerPool::submit(WorkerJob* job, CompletionQueue& completions) {
+	job->_completions = &completions;
+	if (_threads.empty()) {
+		job->run();
+		completions.push(job);
+		return;
+	}
+	MutexLock lock(_lock);
+	_jobs.push_back(job);
+	_ready.signal();
+}
+
+void* WorkerPool::_work(void* arg) {
+	WorkerPool* pool = static_cast<WorkerPool*>(arg);
+
+	while (true) {
+		WorkerJob* job;
+		{
+			MutexLock lock(pool->_lock);
+			while (pool->_jobs.empty() && !pool->_stopping)
+				pool->_ready.wait(pool->_lock);
+			if (pool->_stopping)
+				return NULL;
+			job = pool->_jobs.front();
+			pool->_jobs.pop_front();
+		}
+		job->run();
+		job->_completions->push(job);
+	}
+}
@@ -0,0 +1,63 @@
+#include "../../incs/classes/CommandStats.hpp"
+
+#include <ctime>				// clock_gettime()
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+// --- PUBLIC
+CommandStats::CommandStats(size_t commandCount) : _entries(commandCount) {
+	reset();
+}
+CommandStats::~CommandStats() {}
+
+// --- PRIVATE
+CommandStats::CommandStats() {}
+CommandStats::CommandStats(const CommandStats& src) {(void) src;}
+CommandStats& CommandStats::operator=(const CommandStats& src) {(void) src; return *this;}
+
+
+// === CLOCK ===
+
+unsigned long CommandStats::now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<unsigned long>(ts.tv_sec) * 1000000UL + static_cast<unsigned long>(ts.tv_nsec) / 1000UL;
+}
+
+
+// === RECORD ===
+
+void CommandStats::record(size_t command, unsigned long elapsed, bool failed) {
+	if (command >= _entries.size())
+		return;
+	Entry& entry = _entries[command];
+	++entry.calls;
+	if (failed)
+		++entry.errors;
+	entry.latency.record(elapsed);
+}
+
+void CommandStats::reset() {
+	for (size_t i = 0; i < _entries.size(); ++i) {
+		_entries[i].calls = 0;
+		_entries[i].errors = 0;
+		_entries[i].latency.reset();
+	}
+}
+
+
+// === GETTERS ===
+
+size_t CommandStats::size() const {
+	return _entries.size();
+}
+unsigned long CommandStats::calls(size_t command) const {
+	return _entries[command].calls;
+}
+unsigned long CommandStats::errors(size_t command) const {
+	return _entries[command].errors;
+}
+const LatencyHistogram& CommandStats::latency(size_t command) const {
+	return _entries[command].latency;
+}
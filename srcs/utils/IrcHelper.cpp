@@ -271,27 +271,28 @@ std::string IrcHelper::formatUsername(const std::string& username)
 // === MESSAGES HELPER ===
 
 /**
- * @brief Sanitizes an IRC message by removing the leading character if necessary.
+ * @brief Returns the free text parameter of a command (message, reason, topic...).
  *
- * This function checks if the given IRC message needs to be sanitized based on the command type.
- * If the command is PART, KICK, PRIVMSG, TOPIC, AWAY or QUIT, and the message does not start with a colon (:),
- * or if the command is QUIT_SERVER and the message does not start with a colon or is not a printable sentence,
+ * This function checks that the parameter is the trailing one of the parsed line.
+ * If the command is PART, KICK, PRIVMSG, TOPIC, AWAY or QUIT, and the text was not introduced by a colon (:),
+ * or if the command is QUIT and the text is not a printable sentence,
  * it throws an invalid_argument exception.
  *
- * @param msg The IRC message to be sanitized.
+ * @param message The parsed line.
+ * @param index The index of the text parameter.
  * @param cmd The IRC command associated with the message.
  * @param nickname The nickname of the user sending the message.
- * @return The sanitized IRC message with the leading character removed.
+ * @return The text, without its leading colon.
  * @throws std::invalid_argument if the message does not meet the required conditions for the given command.
  */
-std::string IrcHelper::sanitizeIrcMessage(std::string msg, const std::string& cmd, const std::string& nickname)
+std::string IrcHelper::sanitizeIrcMessage(const IrcMessage& message, size_t index, const std::string& cmd, const std::string& nickname)
 {
 	// PART, KICK PRIVMSG, TOPIC, QUIT
-	if (((cmd == PART || cmd == KICK || cmd == PRIVMSG || cmd == TOPIC || cmd == AWAY) && msg[0] != ':')
-		|| (cmd == QUIT && (msg[0] != ':' || Utils::isPrintableSentence(msg) == false)))
+	if (((cmd == PART || cmd == KICK || cmd == PRIVMSG || cmd == TOPIC || cmd == AWAY) && !message.isTrailing(index))
+		|| (cmd == QUIT && (!message.isTrailing(index) || Utils::isPrintableSentence(message.param(index)) == false)))
 		throw std::invalid_argument(MessageHandler::ircNeedMoreParams(nickname, cmd));
 
-	return msg.erase(0, 1);
+	return message.param(index).str();
 }
 
 
@@ -460,35 +461,33 @@ size_t IrcHelper::howManyArgsIsWaiting(std::string mode)
 }
 
 /**
- * @brief Parses a vector of arguments to determine which mode corresponds to which argument.
+ * @brief Parses the parameters of a MODE command to determine which mode corresponds to which argument.
  *
- * This function takes a vector of strings as input, where the first element is expected to be a mode string
- * (e.g., "+o-k+l") and the subsequent elements are the arguments corresponding to those modes. It returns a map
+ * The second parameter of the parsed line is expected to be a mode string (e.g., "+o-k+l") and the
+ * subsequent parameters are the arguments corresponding to those modes. It returns a map
  * where the keys are mode characters ('o', 'k', 'l', etc.) and the values are the corresponding arguments.
  *
- * @param args A vector of strings containing the mode string and its corresponding arguments.
+ * @param message The parsed MODE line: target, mode string and mode arguments.
  * @return A map where the keys are mode characters and the values are the corresponding arguments.
  */
-std::map<char, std::string> IrcHelper::whichModeForWhichArg(std::vector<std::string> args)
+std::map<char, std::string> IrcHelper::whichModeForWhichArg(const IrcMessage& message)
 {
-	std::string mode = *++args.begin();
+	std::string mode = message.param(1).str();
 	std::map<char, std::string> mode_args;
-	std::vector<std::string>::iterator args_mode_it = ++args.begin();
-	args_mode_it++;
-	std::map<char, std::string>::iterator it_mode;
+	size_t args_mode_it = 2;
 
 	for (size_t i = 0; i < mode.size(); i++)
 	{
 		if (mode[i] == 'o' || mode[i] == 'k')
 		{
-			mode_args.insert(std::make_pair(mode[i], *args_mode_it));
+			mode_args.insert(std::make_pair(mode[i], message.param(args_mode_it).str()));
 			args_mode_it++;
 		}
 		else if (mode[i] == 'l')
 		{
 			if (mode[findCharFromPosition(mode, '-', '+', i)] == '+')
 			{
-				mode_args.insert(std::make_pair(mode[i], *args_mode_it));//on met la nouvelle cle + arg qui nous interesse
+				mode_args.insert(std::make_pair(mode[i], message.param(args_mode_it).str()));//on met la nouvelle cle + arg qui nous interesse
 				args_mode_it++;											//on avance. si on decide de prendre que le 1er, juste a supprimer la conditiom
 			}
 		}
@@ -0,0 +1,107 @@
+#include "../../incs/classes/IrcMessage.hpp"
+
+// =========================================================================================
+
+IrcMessage::IrcMessage() : _paramCount(0), _trailing(false) {}
+IrcMessage::~IrcMessage() {}
+
+
+// === PARSING ===
+
+/**
+ * @brief Splits a line into prefix, command and parameters, in one pass.
+ *
+ * The line is not modified and nothing is copied: every field is a view into it.
+ * A previous parse is forgotten.
+ *
+ * @param line The line, without its "\r\n".
+ * @param length The length of the line.
+ * @return bool false if the line has no command (empty, spaces only, or prefix only).
+ */
+bool IrcMessage::parse(const char* line, size_t length) {
+
+	size_t pos = 0;
+	size_t start = 0;
+
+	_line = StringView(line, length);
+	_prefix = StringView();
+	_command = StringView();
+	_paramCount = 0;
+	_trailing = false;
+
+	while (pos < length && line[pos] == ' ')
+		++pos;
+
+	// Préfixe (":nick!user@host"), jusqu'au premier espace
+	if (pos < length && line[pos] == ':') {
+		start = ++pos;
+		while (pos < length && line[pos] != ' ')
+			++pos;
+		_prefix = StringView(line + start, pos - start);
+		while (pos < length && line[pos] == ' ')
+			++pos;
+	}
+
+	start = pos;
+	while (pos < length && line[pos] != ' ')
+		++pos;
+	_command = StringView(line + start, pos - start);
+	if (_command.empty())
+		return false;
+
+	while (_paramCount < server::MESSAGE_MAX_PARAMS) {
+		while (pos < length && line[pos] == ' ')
+			++pos;
+		if (pos >= length)
+			break;
+
+		// Dernier paramètre : le reste de la ligne, espaces compris
+		if (line[pos] == ':' || _paramCount == server::MESSAGE_MAX_PARAMS - 1) {
+			if (line[pos] == ':')
+				++pos;
+			_params[_paramCount++] = StringView(line + pos, length - pos);
+			_trailing = true;
+			break;
+		}
+
+		start = pos;
+		while (pos < length && line[pos] != ' ')
+			++pos;
+		_params[_paramCount++] = StringView(line + start, pos - start);
+	}
+	return true;
+}
+
+
+// === GETTERS ===
+
+const StringView& IrcMessage::line() const {
+	return _line;
+}
+const StringView& IrcMessage::prefix() const {
+	return _prefix;
+}
+const StringView& IrcMessage::command() const {
+	return _command;
+}
+size_t IrcMessage::paramCount() const {
+	return _paramCount;
+}
+StringView IrcMessage::param(size_t index) const {
+	return index < _paramCount ? _params[index] : StringView();
+}
+
+/**
+ * @brief Returns the end of the line from parameter `index` (the ':' of a trailing
+ * parameter excluded), e.g. to check the characters of every remaining parameter.
+ */
+StringView IrcMessage::paramsFrom(size_t index) const {
+	if (index >= _paramCount)
+		return StringView();
+	const char* start = _params[index].data;
+	return StringView(start, _line.data + _line.size - start);
+}
+
+bool IrcMessage::isTrailing(size_t index) const {
+	return _trailing && index + 1 == _paramCount;
+}
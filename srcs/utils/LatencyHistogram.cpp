@@ -0,0 +1,129 @@
+#include "../../incs/classes/LatencyHistogram.hpp"
+
+#include <cstring>				// memset(), memcpy()
+
+// =========================================================================================
+// === CONSTRUCTORS / DESTRUCTORS ===
+
+LatencyHistogram::LatencyHistogram() {
+	reset();
+}
+LatencyHistogram::LatencyHistogram(const LatencyHistogram& src) {
+	*this = src;
+}
+LatencyHistogram& LatencyHistogram::operator=(const LatencyHistogram& src) {
+	if (this != &src) {
+		std::memcpy(_counts, src._counts, sizeof(_counts));
+		_total = src._total;
+		_max = src._max;
+		_sum = src._sum;
+	}
+	return *this;
+}
+LatencyHistogram::~LatencyHistogram() {}
+
+
+// === BUCKETS ===
+
+/**
+ * @brief Finds the bucket of a value.
+ *
+ * Below SUB_BUCKETS the value is its own bucket. Otherwise, with `msb` the position of
+ * the highest bit set, the bucket group is msb - SUB_BUCKET_BITS + 1 and the sub-bucket
+ * is given by the SUB_BUCKET_BITS bits that follow the highest one.
+ */
+unsigned int LatencyHistogram::_bucketOf(unsigned long value) {
+
+	if (value < SUB_BUCKETS)
+		return static_cast<unsigned int>(value);
+
+	unsigned int msb = 0;
+	for (unsigned long v = value; v >>= 1; )
+		++msb;
+
+	unsigned int shift = msb - SUB_BUCKET_BITS;
+	unsigned int sub = static_cast<unsigned int>((value >> shift) & (SUB_BUCKETS - 1));
+	return (shift + 1) * SUB_BUCKETS + sub;
+}
+
+unsigned long LatencyHistogram::_bucketHighest(unsigned int bucket) {
+
+	if (bucket < SUB_BUCKETS)
+		return bucket;
+
+	unsigned int shift = bucket / SUB_BUCKETS - 1;
+	unsigned long sub = bucket % SUB_BUCKETS;
+	unsigned long lowest = (SUB_BUCKETS + sub) << shift;
+	return lowest + (1UL << shift) - 1;
+}
+
+
+// === RECORD ===
+
+void LatencyHistogram::record(unsigned long value) {
+	++_counts[_bucketOf(value)];
+	++_total;
+	_sum += value;
+	if (value > _max)
+		_max = value;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+	for (unsigned int i = 0; i < BUCKETS; ++i)
+		_counts[i] += other._counts[i];
+	_total += other._total;
+	_sum += other._sum;
+	if (other._max > _max)
+		_max = other._max;
+}
+
+void LatencyHistogram::reset() {
+	std::memset(_counts, 0, sizeof(_counts));
+	_total = 0;
+	_max = 0;
+	_sum = 0;
+}
+
+
+// === GETTERS ===
+
+unsigned long LatencyHistogram::count() const {
+	return _total;
+}
+unsigned long LatencyHistogram::max() const {
+	return _max;
+}
+unsigned long LatencyHistogram::mean() const {
+	return _total ? _sum / _total : 0;
+}
+
+/**
+ * @brief Computes a percentile.
+ *
+ * The highest value of the bucket holding the requested rank is returned (never more
+ * than the real maximum), so the result errs on the pessimistic side.
+ *
+ * @param percent Between 0 and 100 (e.g. 99.9).
+ * @return unsigned long The percentile, 0 if the histogram is empty.
+ */
+unsigned long LatencyHistogram::percentile(double percent) const {
+
+	if (_total == 0)
+		return 0;
+
+	unsigned long rank = static_cast<unsigned long>(percent / 100.0 * _total + 0.5);
+	if (rank < 1)
+		rank = 1;
+	if (rank > _total)
+		rank = _total;
+
+	unsigned long seen = 0;
+	for (unsigned int i = 0; i < BUCKETS; ++i) {
+		seen += _counts[i];
+		if (seen >= rank) {
+			unsigned long highest = _bucketHighest(i);
+			return highest < _max ? highest : _max;
+		}
+	}
+	return _max;
+}
@@ -0,0 +1,283 @@
+#include "../../incs/classes/Logger.hpp"
+#include "../../incs/classes/MessageHandler.hpp"
+
+#include <iostream>				// std::cout, std::cerr (écriture synchrone)
+#include <cstring>				// memcpy(), strcmp()
+#include <cstdlib>				// getenv()
+#include <cerrno>				// errno
+#include <unistd.h>				// write(), usleep()
+#include <csignal>				// sigfillset(), pthread_sigmask()
+
+// =========================================================================================
+// === STATIC MEMBERS ===
+
+Logger::Record* Logger::_ring = NULL;
+size_t Logger::_mask = 0;
+size_t Logger::_enqueuePos = 0;
+size_t Logger::_dequeuePos = 0;
+unsigned long Logger::_dropped = 0;
+int Logger::_running = 0;
+int Logger::_stopping = 0;
+int Logger::_minLevel = log_level::INFO;
+pthread_t Logger::_thread;
+
+// --- PRIVATE
+Logger::Logger() {}
+Logger::Logger(const Logger& src) {(void) src;}
+Logger& Logger::operator=(const Logger& src) {(void) src; return *this;}
+Logger::~Logger() {}
+
+
+// === START / STOP ===
+
+/**
+ * @brief Allocates the ring buffer and starts the log thread.
+ *
+ * If the thread can't be created, the log simply stays synchronous.
+ *
+ * @param minLevel Records below this level are discarded.
+ */
+void Logger::start(log_level::Level minLevel) {
+
+	_minLevel = minLevel;
+	if (_running)
+		return;
+
+	_ring = new Record[server::LOG_RING_SIZE];
+	_mask = server::LOG_RING_SIZE - 1;
+	for (size_t i = 0; i < server::LOG_RING_SIZE; ++i)
+		_ring[i].sequence = i;
+	_enqueuePos = 0;
+	_dequeuePos = 0;
+	_dropped = 0;
+	_stopping = 0;
+
+	// Le thread de log ne doit pas recevoir les signaux destinés au serveur
+	sigset_t blocked, previous;
+	sigfillset(&blocked);
+	pthread_sigmask(SIG_BLOCK, &blocked, &previous);
+
+	int status = pthread_create(&_thread, NULL, &Logger::_drain, NULL);
+	pthread_sigmask(SIG_SETMASK, &previous, NULL);
+	if (status != 0) {
+		delete[] _ring;
+		_ring = NULL;
+		return;
+	}
+	__atomic_store_n(&_running, 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Writes the pending records and stops the log thread.
+ *
+ * Must be called once the threads that log are stopped: the records they would push
+ * afterwards are written synchronously.
+ */
+void Logger::stop() {
+
+	if (!_running)
+		return;
+
+	__atomic_store_n(&_stopping, 1, __ATOMIC_RELEASE);
+	pthread_join(_thread, NULL);
+	__atomic_store_n(&_running, 0, __ATOMIC_RELEASE);
+
+	delete[] _ring;
+	_ring = NULL;
+}
+
+/**
+ * @brief Reads the minimum level from the IRCSERV_LOG_LEVEL environment variable.
+ *
+ * @return log_level::Level verbose, info (default), warning or error.
+ */
+log_level::Level Logger::levelFromEnv() {
+	const char* value = getenv(server::LOG_LEVEL_ENV.c_str());
+	if (!value)
+		return log_level::INFO;
+	if (!strcmp(value, "verbose"))
+		return log_level::VERBOSE;
+	if (!strcmp(value, "warning"))
+		return log_level::WARNING;
+	if (!strcmp(value, "error"))
+		return log_level::ERROR;
+	return log_level::INFO;
+}
+
+
+// === LOG ===
+
+bool Logger::enabled(log_level::Level level) {
+	return level >= _minLevel;
+}
+
+/**
+ * @brief Logs a message, without ever blocking the caller once the log thread runs.
+ *
+ * @param level The level of the record (error records go to stderr).
+ * @param message The message, without end of line. Truncated past server::LOG_RECORD_MAX bytes.
+ */
+void Logger::log(log_level::Level level, const std::string& message) {
+
+	if (level < _minLevel)
+		return;
+
+	if (__atomic_load_n(&_running, __ATOMIC_ACQUIRE)) {
+		_push(level, message);
+		return;
+	}
+
+	// Pas de thread de log (démarrage, arrêt) : écriture synchrone
+	if (level >= log_level::ERROR)
+		std::cerr << message << std::endl;
+	else
+		std::cout << message << std::endl;
+}
+
+void Logger::verbose(const std::string& message) {
+	log(log_level::VERBOSE, message);
+}
+void Logger::info(const std::string& message) {
+	log(log_level::INFO, message);
+}
+void Logger::warning(const std::string& message) {
+	log(log_level::WARNING, message);
+}
+void Logger::error(const std::string& message) {
+	log(log_level::ERROR, message);
+}
+
+unsigned long Logger::dropped() {
+	return __atomic_load_n(&_dropped, __ATOMIC_RELAXED);
+}
+
+
+// === RING BUFFER ===
+
+/**
+ * @brief Copies a record into the ring (any thread).
+ *
+ * A producer claims a position with a compare-and-swap on _enqueuePos, fills the slot,
+ * then publishes it by setting its sequence (release: the log thread sees the content).
+ * No lock is taken: a full ring makes the record dropped, never the caller wait.
+ *
+ * @return bool False if the record was dropped.
+ */
+bool Logger::_push(int level, const std::string& message) {
+
+	size_t pos = __atomic_load_n(&_enqueuePos, __ATOMIC_RELAXED);
+	Record* record;
+
+	while (true) {
+		record = &_ring[pos & _mask];
+		size_t sequence = __atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE);
+		long diff = static_cast<long>(sequence) - static_cast<long>(pos);
+
+		// Slot libre pour cette position : on tente de la réserver
+		if (diff == 0) {
+			if (__atomic_compare_exchange_n(&_enqueuePos, &pos, pos + 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				break;
+		}
+		// Slot pas encore écrit par le thread de log : buffer plein
+		else if (diff < 0) {
+			__atomic_fetch_add(&_dropped, 1, __ATOMIC_RELAXED);
+			return false;
+		}
+		// Un autre producteur a pris la position : on recommence avec la suivante
+		else
+			pos = __atomic_load_n(&_enqueuePos, __ATOMIC_RELAXED);
+	}
+
+	record->level = level;
+	record->length = message.size() < server::LOG_RECORD_MAX ? message.size() : server::LOG_RECORD_MAX;
+	std::memcpy(record->data, message.data(), record->length);
+
+	// Publie l'enregistrement une fois le contenu écrit
+	__atomic_store_n(&record->sequence, pos + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+/**
+ * @brief Moves the oldest record to the output block of its stream (log thread only).
+ *
+ * @return bool False if the ring is empty (or the next record is not published yet).
+ */
+bool Logger::_pop(std::string& out, std::string& err) {
+
+	Record* record = &_ring[_dequeuePos & _mask];
+	size_t sequence = __atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE);
+	if (sequence != _dequeuePos + 1)
+		return false;
+
+	std::string& dest = record->level >= log_level::ERROR ? err : out;
+	dest.append(record->data, record->length);
+	dest += eol::UNIX;
+
+	// Rend le slot aux producteurs pour le tour suivant
+	__atomic_store_n(&record->sequence, _dequeuePos + _mask + 1, __ATOMIC_RELEASE);
+	++_dequeuePos;
+	return true;
+}
+
+void Logger::_writeAll(int fd, const std::string& data) {
+	size_t written = 0;
+	while (written < data.size()) {
+		ssize_t n = write(fd, data.data() + written, data.size() - written);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			return;
+		}
+		written += n;
+	}
+}
+
+/**
+ * @brief Loop of the log thread.
+ *
+ * Everything available is written with one write() per stream. When the ring is empty
+ * the thread sleeps, longer and longer while nothing is logged (LOG_IDLE_MIN_US up to
+ * LOG_IDLE_MAX_US). Once asked to stop, it leaves as soon as the ring is empty.
+ *
+ * @return void* Always NULL.
+ */
+void* Logger::_drain(void* arg) {
+
+	(void) arg;
+	std::string out;
+	std::string err;
+	unsigned long reported = 0;
+	unsigned int idle = server::LOG_IDLE_MIN_US;
+
+	while (true) {
+		// Lu avant de vider le buffer : tout ce qui a été poussé avant l'arrêt est écrit
+		bool stopping = __atomic_load_n(&_stopping, __ATOMIC_ACQUIRE) != 0;
+
+		size_t count = 0;
+		while (count < server::LOG_RING_SIZE && _pop(out, err))
+			++count;
+
+		unsigned long drops = dropped();
+		if (drops != reported) {
+			err += MessageHandler::msgLogRecordsDropped(drops - reported) + eol::UNIX;
+			reported = drops;
+		}
+
+		if (!out.empty())
+			_writeAll(STDOUT_FILENO, out);
+		if (!err.empty())
+			_writeAll(STDERR_FILENO, err);
+		out.clear();
+		err.clear();
+
+		if (count > 0) {
+			idle = server::LOG_IDLE_MIN_US;
+			continue;
+		}
+		if (stopping)
+			break;
+		usleep(idle);
+		idle = idle * 2 < server::LOG_IDLE_MAX_US ? idle * 2 : server::LOG_IDLE_MAX_US;
+	}
+	return NULL;
+}
@@ -20,29 +20,34 @@ MessageHandler::~MessageHandler() {}
 
 // === UTILS ===
 
-// Si le message est trop long on le coupe, et on rajoute \r\n
+// Si le message est trop long on le coupe, et on rajoute \r\n (une seule allocation)
 std::string MessageHandler::ircFormat(const std::string& message) {
-	if (message.length() > server::BUFFER_SIZE)
-		return message.substr(0, server::BUFFER_SIZE) + eol::IRC;
-	return message + eol::IRC;
+	size_t length = message.length() > server::BUFFER_SIZE ? server::BUFFER_SIZE : message.length();
+	std::string line;
+	line.reserve(length + eol::IRC.size());
+	line.append(message, 0, length);
+	line += eol::IRC;
+	return line;
 }
 
 // -- Avant authentification client
 // Format utilisé pour les messages qui n'ont pas de code spécifique
 // mais qui doivent être interprétés par Irssi sans erreur.
 std::string MessageHandler::ircBasicMsg(const std::string& message, const std::string& colorCode) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " NOTICE * :" << colorCode << message << IRC_RESET;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply << ":" << server::NAME << " NOTICE * :" << colorCode << message << IRC_RESET;
+	return line;
 }
 
 // -- Après authentification client
 // Format utilisé pour les messages qui n'ont pas de code spécifique
 // mais qui doivent être interprétés par Irssi sans erreur.
 std::string MessageHandler::ircBasicMsg(const std::string& nickname, const std::string& message, const std::string& colorCode) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " NOTICE " << nickname << " :" << colorCode << message << IRC_RESET;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply << ":" << server::NAME << " NOTICE " << nickname << " :" << colorCode << message << IRC_RESET;
+	return line;
 }
 
 
@@ -55,22 +60,25 @@ std::string MessageHandler::ircClientException(const std::exception &e) {
 // === PING -> PONG ===
 
 std::string MessageHandler::ircPing(void) {
-	std::ostringstream stream;
-	stream << PING << " :" << server::NAME;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply << PING << " :" << server::NAME;
+	return line;
 }
 std::string MessageHandler::ircPong(void) {
-	std::ostringstream stream;
-	stream << PONG << " :" << server::NAME;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply << PONG << " :" << server::NAME;
+	return line;
 }
 
 // === HANDLE CAPABILITIES ===
 
 std::string MessageHandler::ircCapabilities(const std::string& arg) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << CAP << " * " << arg << " :";
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply << ":" << server::NAME << " " << CAP << " * " << arg << " :";
+	return line;
 }
 
 
@@ -78,25 +86,26 @@ std::string MessageHandler::ircCapabilities(const std::string& arg) {
 
 std::string MessageHandler::ircCommandPrompt(const std::string& commandPrompt, const std::string& prevCommand, bool error) {
 	
-	std::ostringstream stream;
+	std::string line;
+	ReplyBuilder reply(line);
 	std::vector<std::string> commands = Utils::getTokens(commandPrompt, splitter::COMMA);
 	std::vector<std::string>::iterator cmd = commands.begin();
 
 	if (error) {
-		stream << ":" << server::NAME << " NOTICE " << server::NAME 
+		reply << ":" << server::NAME << " NOTICE " << server::NAME 
 		<< " :" << IRC_COLOR_ERR << prevCommand << " "
 		<< IRC_COLOR_PROMPT << *cmd << IRC_RESET << eol::IRC;
-		return stream.str();
+		return line;
 	}
 
-	stream << ":" << server::NAME << " NOTICE " << server::NAME << " :" << IRC_COLOR_PROMPT << "Please enter:" << IRC_RESET << eol::IRC;
+	reply << ":" << server::NAME << " NOTICE " << server::NAME << " :" << IRC_COLOR_PROMPT << "Please enter:" << IRC_RESET << eol::IRC;
 	while (cmd != commands.end()) {
-		stream << ":" << server::NAME << " NOTICE " << server::NAME << " :" << IRC_COLOR_PROMPT << *cmd << IRC_RESET;
+		reply << ":" << server::NAME << " NOTICE " << server::NAME << " :" << IRC_COLOR_PROMPT << *cmd << IRC_RESET;
 		if (cmd != --commands.end())
-			stream << eol::IRC;
+			reply << eol::IRC;
 		cmd++;
 	}
-	return stream.str();
+	return line;
 }
 
 std::string MessageHandler::ircUsernameSet(const std::string& username) {
@@ -116,110 +125,121 @@ std::string MessageHandler::ircChangingNickname(const std::string& nickname) {
 
 // --- 001 RPL_WELCOME : Message de bienvenue après une connexion réussie.
 std::string MessageHandler::ircWelcomeMessage(const std::string& nickname, const std::string& usermask) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_WELCOME << " " << nickname 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_WELCOME>(nickname) 
 	<< " :" << IRC_COLOR_INFO << RPL_WELCOME_MSG << IRC_RESET << " " << usermask;
-	return stream.str();
+	return line;
 }
 
 std::string MessageHandler::ircMOTDMessage(const std::string& nickname) {
-	std::ostringstream stream;
+	std::string line;
+	ReplyBuilder reply(line);
 
 	// --- 375 RPL_MOTDSTART : Début du message du jour
-	stream << ":" << server::NAME << " " << RPL_MOTDSTART << " " << nickname 
+	reply.numeric<RPL_MOTDSTART>(nickname) 
 	<< " :" << IRC_PURPLE << "-- " << server::NAME << " " << RPL_MOTDSTART_MSG << " --" << IRC_RESET << eol::IRC;
 	
 	// --- 372 RPL_MOTD : Message du jour
-	stream << ":" << server::NAME << " " << RPL_MOTD << " " << nickname 
+	reply.numeric<RPL_MOTD>(nickname) 
 	<< " :" << IRC_COLOR_DISPLAY << RPL_MOTD_MSG << IRC_RESET << eol::IRC;
 	
 	// --- 376 RPL_ENDOFMOTD : Fin du message du jour
-	stream << ":" << server::NAME << " " << RPL_ENDOFMOTD << " " << nickname 
+	reply.numeric<RPL_ENDOFMOTD>(nickname) 
 	<< " :" << IRC_PURPLE << "-- " << RPL_ENDOFMOTD_MSG << " --" << IRC_RESET;
 
-	return stream.str();
+	return line;
 }
 
 // --- 002 RPL_YOURHOST : Retourne le nom et la version du serveur auquel le client est connecté.
 std::string MessageHandler::ircHostInfos(const std::string& nickname) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_YOURHOST << " " << nickname 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_YOURHOST>(nickname) 
 	<< " :" << IRC_COLOR_INFO << "Host: " << server::NAME << " | Version: " << server::VERSION << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 003 RPL_CREATED : Retourne la date de création du serveur.
 std::string MessageHandler::ircTimeCreation(const std::string& nickname, const std::string& serverCreationTime) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_CREATED << " " << nickname 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_CREATED>(nickname) 
 	<< " :" << IRC_COLOR_INFO << RPL_CREATED_MSG << " " << serverCreationTime << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 004 RPL_MYINFO : Informations sur le serveur et modes disponibles.
 std::string MessageHandler::ircInfos(const std::string& nickname) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_MYINFO << " " << nickname 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_MYINFO>(nickname) 
 	<< " :" << IRC_COLOR_INFO << RPL_MYINFO_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 std::string MessageHandler::ircGlobalUserList(const std::string& nickname, int userCount, int knownCount, int unknownCount, int channelCount) {
-	std::ostringstream stream;
+	std::string line;
+	ReplyBuilder reply(line);
 
 	// Nombre d'utilisateurs inconnus (pas encore identifiés)
-	stream << ":" << server::NAME << " " << RPL_LUSERUNKNOWN << " " << nickname
+	reply.numeric<RPL_LUSERUNKNOWN>(nickname)
 	<< " :Unknown connections: " << unknownCount << eol::IRC;
 
 	// Nombre de canaux actifs
-	stream << ":" << server::NAME << " " << RPL_LUSERCHANNELS << " " << nickname
+	reply.numeric<RPL_LUSERCHANNELS>(nickname)
 	<< " :Channels: " << channelCount << eol::IRC;
 
 	// Nombre total d'utilisateurs sur le serveur
-	stream << ":" << server::NAME << " " << RPL_LUSERME << " " << nickname
+	reply.numeric<RPL_LUSERME>(nickname)
 	<< " :Online users: " << userCount << " (" << knownCount << " authenticated)" << eol::IRC;
 
-	return stream.str();
+	return line;
 }
 
 // --- 431 ERR_NONICKNAMEGIVEN : Aucun nickname fourni.
 std::string MessageHandler::ircNoNicknameGiven(const std::string& nickname) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_NONICKNAMEGIVEN << " " << nickname 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_NONICKNAMEGIVEN>(nickname) 
 	<< " :" << IRC_COLOR_ERR << ERR_NONICKNAMEGIVEN_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 432 ERR_ERRONEUSNICKNAME : Le pseudonyme a des caracteres non autorisés.
 std::string MessageHandler::ircErroneusNickname(const std::string& nickname, const std::string& enteredNickname) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_ERRONEUSNICKNAME << " " << nickname << " " << enteredNickname
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_ERRONEUSNICKNAME>(nickname) << " " << enteredNickname
 	<< " :" << IRC_COLOR_ERR << ERR_ERRONEUSNICKNAME_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 433 ERR_NICKNAMEINUSE : Le pseudonyme choisi est déjà utilisé.
 std::string MessageHandler::ircNicknameTaken(const std::string& nickname, const std::string& enteredNickname) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_NICKNAMEINUSE << " " << nickname << " " << enteredNickname 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_NICKNAMEINUSE>(nickname) << " " << enteredNickname 
 	<< " :" << ERR_NICKNAMEINUSE_MSG;
-	return stream.str();
+	return line;
 }
 
 // --- 464 ERR_PASSWDMISMATCH : Mot de passe incorrect.
 std::string MessageHandler::ircPasswordIncorrect(void) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_PASSWDMISMATCH 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_PASSWDMISMATCH>() 
 	<< " * :" << IRC_COLOR_ERR << ERR_PASSWDMISMATCH_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // 462 ERR_ALREADYREGISTRED : Le client est deja enregistre.
 std::string MessageHandler::ircAlreadyRegistered(const std::string& nickname) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_ALREADYREGISTERED << " " << nickname 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_ALREADYREGISTERED>(nickname) 
 	<< " :" << IRC_COLOR_ERR << ERR_ALREADYREGISTERED_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 
@@ -227,239 +247,276 @@ std::string MessageHandler::ircAlreadyRegistered(const std::string& nickname) {
 
 // Message vers channel
 std::string MessageHandler::ircMsgToChannel(const std::string& nickname, const std::string& channelName, const std::string& message) {
-	std::ostringstream stream;
-	stream << ":" << nickname << " " << PRIVMSG << " " << channelName << " :" << message;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply << ":" << nickname << " " << PRIVMSG << " " << channelName << " :" << message;
+	return line;
 }
 // Message privé client to client
 std::string MessageHandler::ircMsgToClient(const std::string& nickname, const std::string& receiverName, const std::string& message) {
-	std::ostringstream stream;	
-	stream << ":" << nickname << " " << PRIVMSG << " " << receiverName << " :" << message;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply << ":" << nickname << " " << PRIVMSG << " " << receiverName << " :" << message;
+	return line;
 }
 // Message envoyé aux autres clients d'un channel quand un client join ce channel
 std::string MessageHandler::ircClientJoinChannel(const std::string& usermask, const std::string& channelName) {
-	std::ostringstream stream;	
-	stream << ":" << usermask << " " << JOIN << " :" << channelName;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply << ":" << usermask << " " << JOIN << " :" << channelName;
+	return line;
 }
 // Message envoyé aux autres clients d'un channel quand un opérateur change un mode
 std::string MessageHandler::ircOpeChangedMode(const std::string& usermask, const std::string& channelName, const std::string& changedMode, const std::string& parameter) {
-	std::ostringstream stream;	
+	std::string line;
+	ReplyBuilder reply(line);
 	std::string param = !parameter.empty() ? " " + parameter : "";
-	stream << ":" << usermask << " " << MODE << " " << channelName << " " << changedMode << param;
-	return stream.str();
+	reply << ":" << usermask << " " << MODE << " " << channelName << " " << changedMode << param;
+	return line;
 }
 // Message envoyé aux autres clients d'un channel quand le topic est change
 std::string MessageHandler::ircTopicMessage(const std::string& usermask, const std::string& channelName, const std::string& topic) {
-	std::ostringstream stream;
-	stream << ":" << usermask << " " << TOPIC << " " << channelName << " :" << topic;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply << ":" << usermask << " " << TOPIC << " " << channelName << " :" << topic;
+	return line;
 }
 // Message envoyé aux autres clients d'un channel quand un client est kick
 std::string MessageHandler::ircClientKickUser(const std::string& usermask, const std::string& channelName, const std::string& kickedUser, const std::string& reason) {
-	std::ostringstream stream;
+	std::string line;
+	ReplyBuilder reply(line);
 	std::string givenReason = !reason.empty() ? " :" + reason : "";
-	stream << ":" << usermask << " " << KICK << " " << channelName << " " << kickedUser << givenReason;
-	return stream.str();
+	reply << ":" << usermask << " " << KICK << " " << channelName << " " << kickedUser << givenReason;
+	return line;
 }
 // Message envoyé aux autres clients d'un channel quand un client s'en va
 std::string MessageHandler::ircClientPartChannel(const std::string& usermask, const std::string& channelName, const std::string& reason) {
-	std::ostringstream stream;
+	std::string line;
+	ReplyBuilder reply(line);
 	std::string givenReason = !reason.empty() ? " :" + reason : "";
-	stream << ":" << usermask << " " << PART << " " << channelName << givenReason;
-	return stream.str();
+	reply << ":" << usermask << " " << PART << " " << channelName << givenReason;
+	return line;
 }
 // Message envoyé aux autres clients d'un channel quand un client quitte le serveur
 std::string MessageHandler::ircClientQuitServer(const std::string& usermask, const std::string& message) {
-	std::ostringstream stream;	
-	stream << ":" << usermask << " " << QUIT << " :Quit: " << message;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply << ":" << usermask << " " << QUIT << " :Quit: " << message;
+	return line;
 }
 // Message d'erreur envoyé au client avant de fermer sa connexion
 std::string MessageHandler::ircErrorQuitServer(const std::string& reason) {
-	std::ostringstream stream;
-	stream << "ERROR :" << reason;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply << "ERROR :" << reason;
+	return line;
 }
 
 
 // === RPL CHANNELS ===
 
+// --- 353 RPL_NAMREPLY : Liste des utilisateurs présents dans un canal (une ligne, voir Channel::sendNames).
 std::string MessageHandler::ircNameReply(const std::string& nickname, const std::string& channelName, const std::string& users) {
-	std::ostringstream stream;
-	// --- 353 RPL_NAMREPLY : Liste des utilisateurs présents dans un canal.
-	stream	<< ":" << server::NAME << " " << RPL_NAMREPLY << " " << nickname << " = " << channelName << " :" << users << eol::IRC;
-	// --- 366 RPL_ENDOFNAMES : Fin de la liste des utilisateurs pour un canal.
-	stream	<< ":" << server::NAME << " " << RPL_ENDOFNAMES << " " << nickname << " " << channelName << " :" << RPL_ENDOFNAMES_MSG;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_NAMREPLY>(nickname) << " = " << channelName << " :" << users;
+	return line;
+}
+
+// --- 366 RPL_ENDOFNAMES : Fin de la liste des utilisateurs pour un canal.
+std::string MessageHandler::ircEndOfNames(const std::string& nickname, const std::string& channelName) {
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_ENDOFNAMES>(nickname) << " " << channelName << " :" << RPL_ENDOFNAMES_MSG;
+	return line;
 }
 
 // --- 331 RPL_NOTOPIC : Aucun sujet défini pour le canal.
 std::string MessageHandler::ircNoTopic(const std::string& nickname, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_NOTOPIC << " " << nickname << " " << channelName
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_NOTOPIC>(nickname) << " " << channelName
 	<< " :" << IRC_COLOR_INFO << RPL_NOTOPIC_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 332 RPL_TOPIC : Sujet actuel du canal.
 std::string MessageHandler::ircTopic(const std::string& nickname, const std::string& channelName, const std::string& topic) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_TOPIC << " " << nickname << " " << channelName
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_TOPIC>(nickname) << " " << channelName
 		<< " :" << IRC_COLOR_INFO << topic << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 333 RPL_TOPICWHOTIME : Informations supplémentaires sur qui a défini le sujet et à quelle heure.
 std::string MessageHandler::ircTopicWhoTime(const std::string& nickname, const std::string& setterNick, const std::string& channelName, time_t topicTime) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_TOPICWHOTIME << " " << nickname << " " << channelName << " " << setterNick
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_TOPICWHOTIME>(nickname) << " " << channelName << " " << setterNick
 	<< " " << topicTime;
-	return stream.str();
+	return line;
 }
 
 // --- 403 ERR_NOSUCHCHANNEL : Le canal spécifié n'existe pas.
 std::string MessageHandler::ircNoSuchChannel(const std::string& nickname, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_NOSUCHCHANNEL << " " << nickname << " " << channelName 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_NOSUCHCHANNEL>(nickname) << " " << channelName 
 	<< " :" << IRC_COLOR_ERR << ERR_NOSUCHCHANNEL_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 404 ERR_CANNOTSENDTOCHAN : Le message n'a pas pu etre delivre au canal.
 std::string MessageHandler::ircCannotSendToChan(const std::string& nickname, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_CANNOTSENDTOCHAN << " " << nickname << " " << channelName 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_CANNOTSENDTOCHAN>(nickname) << " " << channelName 
 	<< " :" << IRC_COLOR_ERR << ERR_CANNOTSENDTOCHAN_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 411 ERR_NORECIPIENT : Pas de destinataire.
 std::string MessageHandler::ircNoRecipient(const std::string& nickname) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_NORECIPIENT << " " << nickname 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_NORECIPIENT>(nickname) 
 	<< " :" << IRC_COLOR_ERR << ERR_NORECIPIENT_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 412 ERR_NOTEXTTOSEND : Aucun message à envoyer.
 std::string MessageHandler::ircNoTextToSend(const std::string& nickname) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_NOTEXTTOSEND << " " << nickname 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_NOTEXTTOSEND>(nickname) 
 	<< " :" << IRC_COLOR_ERR << ERR_NOTEXTTOSEND_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 417 ERR_INPUTTOOLONG : Message trop long.
 std::string MessageHandler::ircLineTooLong(const std::string& nickname) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_INPUTTOOLONG << " " << nickname 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_INPUTTOOLONG>(nickname) 
 	<< " :" << IRC_COLOR_ERR << ERR_INPUTTOOLONG_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 441 ERR_USERNOTINCHANNEL : L'utilisateur cible n'est pas dans le canal.
 std::string MessageHandler::ircNotInChannel(const std::string& nickname, const std::string& channelName, const std::string &targetNick) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_USERNOTINCHANNEL << " " << nickname << " " << targetNick << " " << channelName 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_USERNOTINCHANNEL>(nickname) << " " << targetNick << " " << channelName 
 	<< " :" << IRC_COLOR_ERR << ERR_USERNOTINCHANNEL_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 442 ERR_NOTONCHANNEL : Le présent utilisateur n'est pas dans le canal.
 std::string MessageHandler::ircCurrentNotInChannel(const std::string& nickname, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_NOTONCHANNEL << " " << nickname << " " << channelName 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_NOTONCHANNEL>(nickname) << " " << channelName 
 	<< " :" << IRC_COLOR_ERR << ERR_NOTONCHANNEL_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 341 RPL_INVITING : L'utilisateur a été invité dans le canal.
 std::string MessageHandler::ircInviting(const std::string& nickname, const std::string& targetNick, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_INVITING << " " << nickname << " " << targetNick << " " << channelName;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_INVITING>(nickname) << " " << targetNick << " " << channelName;
+	return line;
 }
 
 // 471 ERR_CHANNELISFULL : Channel full.
 std::string MessageHandler::ircChannelFull(const std::string& nickname, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_CHANNELISFULL << " " << nickname << " " << channelName
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_CHANNELISFULL>(nickname) << " " << channelName
 	<< " :" << IRC_COLOR_ERR << ERR_CHANNELISFULL_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 443 ERR_USERONCHANNEL : Quand un client invité au canal est déja dans le canal.
 std::string MessageHandler::ircAlreadyOnChannel(const std::string& nickname, const std::string& targetNick, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_USERONCHANNEL << " " << nickname << " " << targetNick << " " << channelName 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_USERONCHANNEL>(nickname) << " " << targetNick << " " << channelName 
 	<< " :" << IRC_COLOR_ERR << ERR_USERONCHANNEL_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 465 ERR_YOUREBANNEDCREEP : L'utilisateur est banni du serveur.
 std::string MessageHandler::ircBannedFromServer(const std::string& nickname, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_YOUREBANNEDCREEP << " " << nickname << " " << channelName
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_YOUREBANNEDCREEP>(nickname) << " " << channelName
 	<< " :" << IRC_COLOR_ERR << ERR_YOUREBANNEDCREEP_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 472 ERR_UNKNOWNMODE : Mode inconnu.
 std::string MessageHandler::ircUnknownMode(const std::string& nickname, char character) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_UNKNOWNMODE << " " << nickname << " " << character
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_UNKNOWNMODE>(nickname) << " " << character
 	<< " :" << IRC_COLOR_ERR << ERR_UNKNOWNMODE_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 473 ERR_INVITEONLYCHAN : Le canal est en mode invitation (+i), et l'utilisateur n'est pas invité.
 std::string MessageHandler::ircInviteOnly(const std::string& nickname, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_INVITEONLYCHAN << " " << nickname << " " << channelName
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_INVITEONLYCHAN>(nickname) << " " << channelName
 	<< " :" << IRC_COLOR_ERR << ERR_INVITEONLYCHAN_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 474 ERR_BANNEDFROMCHAN : L'utilisateur est banni (+b) du canal.
 std::string MessageHandler::ircBannedFromChannel(const std::string& nickname, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_BANNEDFROMCHAN << " " << nickname << " " << channelName
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_BANNEDFROMCHAN>(nickname) << " " << channelName
 	<< " :" << IRC_COLOR_ERR << ERR_BANNEDFROMCHAN_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 475 ERR_BADCHANNELKEY : Mauvais mot de passe pour rejoindre le canal.
 std::string MessageHandler::ircWrongChannelPass(const std::string& nickname, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_BADCHANNELKEY << " " << nickname << " " << channelName
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_BADCHANNELKEY>(nickname) << " " << channelName
 	<< " :" << IRC_COLOR_ERR << ERR_BADCHANNELKEY_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 476 ERR_BADCHANMASK : Nom du channel mal formaté ou invalide (#).
 std::string MessageHandler::ircBadChannelName(const std::string& nickname, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_BADCHANMASK << " " << nickname << " " << channelName 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_BADCHANMASK>(nickname) << " " << channelName 
 	<< " :" << IRC_COLOR_ERR << ERR_BADCHANMASK_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 477 ERR_NEEDREGGEDNICK : Certains serveurs nécessitent un pseudo enregistré (+r).
 std::string MessageHandler::ircNeedNick(const std::string& nickname, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_NEEDREGGEDNICK << " " << nickname << " " << channelName
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_NEEDREGGEDNICK>(nickname) << " " << channelName
 	<< " :" << IRC_COLOR_ERR << ERR_NEEDREGGEDNICK_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 482 ERR_CHANOPRIVSNEEDED : L’utilisateur n'est pas opérateur et essaie une action nécessitant des droits d'opérateur.
 std::string MessageHandler::ircNotChanOperator(const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_CHANOPRIVSNEEDED << " " << channelName 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_CHANOPRIVSNEEDED>(channelName) 
 	<< " :" << IRC_COLOR_ERR << ERR_CHANOPRIVSNEEDED_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 
@@ -495,97 +552,108 @@ std::string MessageHandler::ircNoPassNeeded(const std::string& channelName) {
 
 std::string MessageHandler::ircNicknameSet(const std::string& oldNickname, const std::string& newNickname) {
 	std::string oldNick = !oldNickname.empty() ? oldNickname : "unknown";
-	std::ostringstream stream;
-	stream << ":" << oldNickname << " " << NICK << " " << newNickname;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply << ":" << oldNickname << " " << NICK << " " << newNickname;
+	return line;
 }
 
 // --- 401 ERR_NOSUCHNICK : Le pseudonyme spécifié n'existe pas.
 std::string MessageHandler::ircNoSuchNick(const std::string& nickname, const std::string& targetNick) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_NOSUCHNICK << " " << nickname << " " << targetNick 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_NOSUCHNICK>(nickname) << " " << targetNick 
 	<< " :" << IRC_COLOR_ERR << ERR_NOSUCHNICK_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // --- 301 RPL_AWAY : L'utilisateur est absent.
 std::string MessageHandler::ircClientIsAway(const std::string& nickname, const std::string& targetNick, const std::string& message) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_AWAY << " " << nickname << " "
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_AWAY>(nickname) << " "
 	<< targetNick << " :" << message;
-	return stream.str();
+	return line;
 }
 
 // --- 305 RPL_UNAWAY : L'utilisateur n'est plus absent.
 std::string MessageHandler::ircUnAway(const std::string& nickname) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_UNAWAY << " " << nickname << " :" << RPL_UNAWAY_MSG;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_UNAWAY>(nickname) << " :" << RPL_UNAWAY_MSG;
+	return line;
 }
 
 // --- 306 RPL_NOWAWAY : L'utilisateur est maintenant absent.
 std::string MessageHandler::ircAway(const std::string& nickname) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_NOWAWAY << " " << nickname << " :" << RPL_NOWAWAY_MSG;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_NOWAWAY>(nickname) << " :" << RPL_NOWAWAY_MSG;
+	return line;
 }
 
 std::string MessageHandler::ircWhois(const std::string& nickname, const std::string& targetNick, const std::string& username, 
 	const std::string& realname, const std::string& clientIp) {
-	std::ostringstream stream;
+	std::string line;
+	ReplyBuilder reply(line);
 	
 	// RPL_WHOISUSER (311) : Informations de base sur l'utilisateur
-	stream << ":" << server::NAME << " " << RPL_WHOISUSER << " " << nickname << " "
+	reply.numeric<RPL_WHOISUSER>(nickname) << " "
 	<< targetNick << " " << username << " " << clientIp << " * :" << realname << eol::IRC;
 
 	// RPL_WHOISSERVER (312) : Serveur de l'utilisateur
-	stream << ":" << server::NAME << " " << RPL_WHOISSERVER << " " << nickname << " "
+	reply.numeric<RPL_WHOISSERVER>(nickname) << " "
 	<< targetNick << " " << server::NAME << " :" << RPL_WHOISSERVER_MSG << eol::IRC;
 
-	return stream.str();
+	return line;
 }
 
 // RPL_WHOISUSER (311) : Temps d'inactivité de l'utilisateur.
 std::string MessageHandler::ircWhoisIdle(const std::string& nickname, const std::string& targetNick, time_t idleTime, time_t signonTime) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_WHOISIDLE << " " << nickname << " "
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_WHOISIDLE>(nickname) << " "
 	<< targetNick << " " << idleTime << " " << signonTime << " :" << RPL_WHOISIDLE_MSG << eol::IRC;
-	return stream.str();
+	return line;
 }
 
 // RPL_ENDOFWHOIS (318) : Fin du WHOIS
 std::string MessageHandler::ircEndOfWhois(const std::string& nickname, const std::string& targetNick) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_ENDOFWHOIS << " " << nickname << " " 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_ENDOFWHOIS>(nickname) << " " 
 	<< targetNick << " :" << RPL_ENDOFWHOIS_MSG << eol::IRC;
-	return stream.str();
+	return line;
 }
 
 // RPL_WHOREPLY (352) : Liste des utilisateurs du canal
 std::string MessageHandler::ircWho(const std::string& nickname, const std::string& targetNick, const std::string& username, 
 	const std::string& realname, const std::string& clientIp, const std::string& channelName, bool isAway) {
 	std::string awayChar = isAway ? "G" : "H";
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_WHOREPLY << " " << nickname << " " 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_WHOREPLY>(nickname) << " " 
 	<< channelName << " " << username << " " << clientIp << " " << server::NAME << " " 
 	<< targetNick << " " << awayChar << " :" << 0 << " " << realname << eol::IRC;
-	return stream.str();
+	return line;
 }
 
 // RPL_ENDOFWHO (315) : Fin de la liste
 std::string MessageHandler::ircEndOfWho(const std::string& nickname, const std::string& channelName) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_ENDOFWHO << " " << nickname << " " 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_ENDOFWHO>(nickname) << " " 
 	<< channelName << " :" << RPL_ENDOFWHO_MSG << eol::IRC;
-	return stream.str();
+	return line;
 }
 
 // RPL_ENDOFWHOWAS (369) : Fin du WHOIS
 std::string MessageHandler::ircEndOfWhowas(const std::string& nickname, const std::string& targetNick) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_ENDOFWHOWAS << " " << nickname << " " 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_ENDOFWHOWAS>(nickname) << " " 
 	<< targetNick << " :" << RPL_ENDOFWHOWAS_MSG << eol::IRC;
-	return stream.str();
+	return line;
 }
 
 
@@ -594,26 +662,98 @@ std::string MessageHandler::ircEndOfWhowas(const std::string& nickname, const st
 // --- 421 ERR_UNKNOWNCOMMAND : La commande n'est pas reconnue par le serveur.
 std::string MessageHandler::ircUnknownCommand(const std::string& nickname, const std::string& command) {
 	std::string cmd = Utils::truncateStr(Utils::streamArg(command));
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_UNKNOWNCOMMAND << " " << nickname << " " << cmd 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_UNKNOWNCOMMAND>(nickname) << " " << cmd 
 	<< " :" << IRC_COLOR_ERR << ERR_UNKNOWNCOMMAND_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 	
 // 461 ERR_NEEDMOREPARAMS : Il manque des paramètres pour une commande.
 std::string MessageHandler::ircNeedMoreParams(const std::string& nickname, const std::string& command) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_NEEDMOREPARAMS << " " << nickname << " " << command 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_NEEDMOREPARAMS>(nickname) << " " << command 
 	<< " :" << IRC_COLOR_ERR << ERR_NEEDMOREPARAMS_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // 451 ERR_NOTREGISTERED : L'utilisateur doit être enregistré avant de pouvoir exécuter des commandes.
 std::string MessageHandler::ircNotRegistered(void) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_NOTREGISTERED 
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_NOTREGISTERED>() 
 	<< " :" << IRC_COLOR_ERR << ERR_NOTREGISTERED_MSG << IRC_RESET;
-	return stream.str();
+	return line;
+}
+
+
+// === OPERATOR ===
+
+// --- 381 RPL_YOUREOPER : Le client est maintenant opérateur du serveur.
+std::string MessageHandler::ircYoureOper(const std::string& nickname) {
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_YOUREOPER>(nickname)
+	<< " :" << IRC_COLOR_SUCCESS << RPL_YOUREOPER_MSG << IRC_RESET;
+	return line;
+}
+
+// --- 481 ERR_NOPRIVILEGES : Commande réservée aux opérateurs du serveur.
+std::string MessageHandler::ircNoPrivileges(const std::string& nickname) {
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_NOPRIVILEGES>(nickname)
+	<< " :" << IRC_COLOR_ERR << ERR_NOPRIVILEGES_MSG << IRC_RESET;
+	return line;
+}
+
+// --- 491 ERR_NOOPERHOST : Aucun accès opérateur configuré sur le serveur.
+std::string MessageHandler::ircNoOperHost(const std::string& nickname) {
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_NOOPERHOST>(nickname)
+	<< " :" << IRC_COLOR_ERR << ERR_NOOPERHOST_MSG << IRC_RESET;
+	return line;
+}
+
+// --- 212 RPL_STATSCOMMANDS : Appels, erreurs et latences (us) d'une commande.
+std::string MessageHandler::ircStatsCommand(const std::string& nickname, const std::string& command, unsigned long calls, unsigned long errors,
+												unsigned long p50, unsigned long p99, unsigned long max) {
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_STATSCOMMANDS>(nickname) << " " << command << " " << calls << " " << errors
+	<< " :p50 " << p50 << "us p99 " << p99 << "us max " << max << "us";
+	return line;
+}
+
+// --- 249 RPL_STATSDEBUG : Occupation d'un pool d'objets.
+std::string MessageHandler::ircStatsPool(const std::string& nickname, const std::string& pool, size_t inUse, size_t peak, size_t capacity, size_t slabs) {
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_STATSDEBUG>(nickname)
+	<< " :" << pool << " pool: " << inUse << " in use, peak " << peak << ", " << capacity << " slots in " << slabs << " slab" << (slabs > 1 ? "s" : "");
+	return line;
+}
+
+// --- 249 RPL_STATSDEBUG : Avancement et débit moyen (octets/s) d'une copie DCC en cours.
+std::string MessageHandler::ircStatsTransfer(const std::string& nickname, const std::string& filename, const std::string& sender, const std::string& receiver,
+												unsigned long copied, off_t size, unsigned long throughput) {
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_STATSDEBUG>(nickname)
+	<< " :DCC " << filename << " " << sender << " -> " << receiver << ": " << copied << " bytes copied of "
+	<< static_cast<unsigned long>(size) << ", " << throughput / 1024 << " KiB/s";
+	return line;
+}
+
+// --- 219 RPL_ENDOFSTATS : Fin du rapport STATS.
+std::string MessageHandler::ircEndOfStats(const std::string& nickname, const std::string& query) {
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_ENDOFSTATS>(nickname) << " " << query
+	<< " :" << RPL_ENDOFSTATS_MSG;
+	return line;
 }
 
 
@@ -622,51 +762,57 @@ std::string MessageHandler::ircNotRegistered(void) {
 // 324 RPL_CHANNELMODEIS :Sent to a client to inform them of the currently-set modes of a channel. <channel> is the name of the channel. <modestring> and <mode arguments> 
 // are a mode string and the mode arguments (delimited as separate parameters) as defined in the MODE message description.
 std::string MessageHandler::ircChannelModeIs(const std::string& nickname, const std::string& channel, const std::string& displaymode) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_CHANNELMODEIS << " " << nickname << " " << channel << " " << displaymode;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_CHANNELMODEIS>(nickname) << " " << channel << " " << displaymode;
+	return line;
 }
 // :server 324 <nickname> <channel> <modes> <mode_params>
 
 // 329 RPL_CREATIONTIME : Sent to a client to inform them of the creation time of a channel. <creationtime> is a unix timestamp representing when the channel was created on the network.
 std::string MessageHandler::ircCreationTime(const std::string& nickname, const std::string& channel, time_t time) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_CREATIONTIME << " " << nickname << " " << channel << " " << time;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_CREATIONTIME>(nickname) << " " << channel << " " << time;
+	return line;
 }
 
 // 696 ERR_INVALIDMODEPARAM : Indicates that there was a problem with a mode parameter. Replaces various implementation-specific mode-specific numerics.
 std::string MessageHandler::ircInvalidModeParams(const std::string &nickname, const std::string& channel, const std::string& mode_char, const std::string &param) {
 	std::string parameter = Utils::truncateStr(Utils::streamArg(param));
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_INVALIDMODEPARAM << " " << nickname << " " << channel << " "
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_INVALIDMODEPARAM>(nickname) << " " << channel << " "
 	<< mode_char << " " << parameter << " :" << IRC_COLOR_ERR << ERR_INVALIDMODEPARAM_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 // 367 RPL_BANLIST : Sent as a reply to the MODE command, when clients are viewing the current entries on a channel’s ban list. 
 std::string MessageHandler::ircBannedList(const std::string &nickname, const std::string &channel, const std::string &who, time_t time_channel) //ptet pas le bon chan
 {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_BANLIST << " " << IRC_COLOR_INFO << nickname << " " << channel << " *!*@* " << who << " " << time_channel << IRC_RESET;
-	return stream.str();
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_BANLIST>() << " " << IRC_COLOR_INFO << nickname << " " << channel << " *!*@* " << who << " " << time_channel << IRC_RESET;
+	return line;
 }
 
 // 368 RPL_ENDOFBANLIST : Sent as a reply to the MODE command, this numeric indicates the end of a channel’s ban list.
 std::string MessageHandler::ircEndOfBannedList(const std::string &nickname, const std::string &channel)
 {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << RPL_ENDOFBANLIST << " " << nickname << " " << channel
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<RPL_ENDOFBANLIST>(nickname) << " " << channel
 	<< " :" << RPL_ENDOFBANLIST_MSG;
-	return stream.str();
+	return line;
 }
 
 // 525 ERR_INVALIDKEY : Indicates the value of a key channel mode change (+k) was rejected.
 std::string MessageHandler::ircInvalidPasswordFormat(const std::string &nickname, const std::string& channel) {
-	std::ostringstream stream;
-	stream << ":" << server::NAME << " " << ERR_INVALIDKEY  << " " << nickname << " " << channel
+	std::string line;
+	ReplyBuilder reply(line);
+	reply.numeric<ERR_INVALIDKEY>()  << " " << nickname << " " << channel
 	<< " :" << IRC_COLOR_ERR << ERR_INVALIDKEY_MSG << IRC_RESET;
-	return stream.str();
+	return line;
 }
 
 
@@ -746,6 +892,23 @@ std::string MessageHandler::msgSignalCaught(const std::string& signalType) {
 	return msgBuilder(COLOR_ERR, signalType + " signal caught, server shutting down...", eol::UNIX);
 }
 
+std::string MessageHandler::msgReactorsStarted(size_t count, const std::string& backend, bool reusePort) {
+	std::ostringstream stream;
+	stream << count << " event loop thread" << (count > 1 ? "s" : "") << " (" << backend << ", "
+		<< (reusePort ? "SO_REUSEPORT listeners" : "shared listener") << ")";
+	return msgBuilder(COLOR_INFO, stream.str(), eol::UNIX);
+}
+
+std::string MessageHandler::msgLogRecordsDropped(unsigned long count) {
+	std::ostringstream stream;
+	stream << count << " log record" << (count > 1 ? "s" : "") << " dropped (log buffer full)";
+	return msgBuilder(COLOR_ERR, stream.str(), "");
+}
+
+std::string MessageHandler::msgSystemError(const std::string& context, int errorNumber) {
+	return msgBuilder(COLOR_ERR, context + ": " + std::strerror(errorNumber), "");
+}
+
 
 // === CLIENTS ===
 
@@ -780,6 +943,10 @@ std::string MessageHandler::msgClientDisconnected(const std::string& clientIp, i
 	return stream.str();
 }
 
+std::string MessageHandler::msgClientIsOperator(const std::string& nickname, const std::string& operName) {
+	return msgBuilder(COLOR_SUCCESS, DEFAULT + nickname + COLOR_SUCCESS + " is now an IRC operator (" + DEFAULT + operName + COLOR_SUCCESS + ")", "");
+}
+
 
 // === CHANNELS ===
 
@@ -827,9 +994,9 @@ std::string MessageHandler::msgSendFile(const std::string& filename, const std::
 	return stream.str();
 }
 
-std::string MessageHandler::errorMsgSendFile(const std::string& filename) {
+std::string MessageHandler::errorMsgSendFile(const std::string& path) {
 	std::ostringstream stream;
-	stream << DCC << " can't open file /home/athiebau/" << filename << ": No such file or directory";
+	stream << DCC << " can't open file " << path << ": No such file or directory";
 	return stream.str();
 }
 
@@ -837,4 +1004,30 @@ std::string MessageHandler::MsgSendingFile(const std::string& filename, const st
 	std::ostringstream stream;
 	stream << DCC << " sending file " << filename << " for " << receiver << " [" << ip << " port " << port << "]";
 	return stream.str();
+}
+
+std::string MessageHandler::msgResumeFile(const std::string& filename, const std::string& receiver, off_t position) {
+	std::ostringstream stream;
+	stream << DCC << " RESUME FROM " << receiver << ": " << filename << " at " << position
+	<< " (DCC ACCEPT " << receiver << " " << filename << " " << position << " to agree)";
+	return stream.str();
+}
+
+std::string MessageHandler::msgAcceptFile(const std::string& filename, const std::string& sender, off_t position) {
+	std::ostringstream stream;
+	stream << DCC << " ACCEPT FROM " << sender << ": " << filename << " at " << position
+	<< " (DCC GET " << sender << " " << filename << " to resume)";
+	return stream.str();
+}
+
+std::string MessageHandler::msgTransferStats(unsigned long copied, unsigned long throughput) {
+	std::ostringstream stream;
+	stream << "(" << copied << " bytes, " << throughput / 1024 << " KiB/s)";
+	return stream.str();
+}
+
+std::string MessageHandler::msgTransferEnded(const std::string& filename, const std::string& sender, const std::string& receiver, bool done, const std::string& stats) {
+	std::ostringstream stream;
+	stream << DCC << " copy of " << filename << " from " << sender << " for " << receiver << (done ? " done " : " failed ") << stats;
+	return msgBuilder(done ? COLOR_SUCCESS : COLOR_ERR, stream.str(), eol::UNIX);
 }
\ No newline at end of file
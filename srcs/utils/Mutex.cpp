@@ -0,0 +1,65 @@
+#include "../../incs/classes/Mutex.hpp"
+
+// =========================================================================================
+// === MUTEX ===
+
+// --- PUBLIC
+Mutex::Mutex() {
+	pthread_mutex_init(&_mutex, NULL);
+}
+Mutex::~Mutex() {
+	pthread_mutex_destroy(&_mutex);
+}
+
+// --- PRIVATE
+Mutex::Mutex(const Mutex& src) {(void) src;}
+Mutex& Mutex::operator=(const Mutex& src) {(void) src; return *this;}
+
+void Mutex::lock() {
+	pthread_mutex_lock(&_mutex);
+}
+void Mutex::unlock() {
+	pthread_mutex_unlock(&_mutex);
+}
+
+
+// =========================================================================================
+// === MUTEX LOCK ===
+
+// --- PUBLIC
+MutexLock::MutexLock(Mutex& mutex) : _mutex(mutex) {
+	_mutex.lock();
+}
+MutexLock::~MutexLock() {
+	_mutex.unlock();
+}
+
+// --- PRIVATE
+MutexLock::MutexLock(const MutexLock& src) : _mutex(src._mutex) {}
+MutexLock& MutexLock::operator=(const MutexLock& src) {(void) src; return *this;}
+
+
+// =========================================================================================
+// === CONDITION ===
+
+// --- PUBLIC
+Condition::Condition() {
+	pthread_cond_init(&_cond, NULL);
+}
+Condition::~Condition() {
+	pthread_cond_destroy(&_cond);
+}
+
+// --- PRIVATE
+Condition::Condition(const Condition& src) {(void) src;}
+Condition& Condition::operator=(const Condition& src) {(void) src; return *this;}
+
+void Condition::wait(Mutex& mutex) {
+	pthread_cond_wait(&_cond, &mutex._mutex);
+}
+void Condition::signal() {
+	pthread_cond_signal(&_cond);
+}
+void Condition::broadcast() {
+	pthread_cond_broadcast(&_cond);
+}
@@ -22,32 +22,31 @@ Utils::~Utils() {}
  * (it may be checked later).
  * It returns true if the command is not one of the following: QUIT, AWAY, NICK, PRIVMSG, WHOIS, PING, or PONG.
  *
- * @param cmd The command to check.
+ * @param cmd The command to check (a name of the dispatch table: compared without copy).
  * @return true if parameter check is needed, false otherwise.
  */
-bool Utils::paramCheckNeeded(const std::string &cmd)
+bool Utils::paramCheckNeeded(const char* cmd)
 {
 	if (cmd != QUIT && cmd != AWAY && cmd != NICK && cmd != PRIVMSG
-		&& cmd != WHOIS && cmd != PING && cmd != PONG)
+		&& cmd != WHOIS && cmd != PING && cmd != PONG && cmd != NAMES)
 		return true;
 	return false;
 }
 
 /**
- * @brief Checks if the iterator points to an empty or invalid string in the vector.
+ * @brief Checks if a parameter (or the rest of a line) is missing or unusable.
  *
- * This function determines if the iterator `it` points to an element in the vector `vec` that is either:
- * - The end of the vector.
+ * This function determines if the string is either:
+ * - Empty.
  * - A string containing only spaces.
  * - A string that is not a printable sentence.
  *
- * @param it An iterator pointing to an element in the vector `vec`.
- * @param vec A vector of strings to be checked.
- * @return true if the iterator points to an empty or invalid string, false otherwise.
+ * @param str The string to be checked (usually a view into the received line).
+ * @return true if the string is empty or invalid, false otherwise.
  */
-bool Utils::isEmptyOrInvalid(const std::vector<std::string>::iterator& it, const std::vector<std::string>& vec)
+bool Utils::isEmptyOrInvalid(const StringView& str)
 {
-	if (it == vec.end() || isOnlySpace(*it) == true || isPrintableSentence(*it) == false)
+	if (str.empty() || isOnlySpace(str) == true || isPrintableSentence(str) == false)
 		return true;
 	return false;
 }
@@ -62,9 +61,9 @@ bool Utils::isEmptyOrInvalid(const std::vector<std::string>::iterator& it, const
  * @param str The string to be checked.
  * @return true if the string contains only whitespace characters, false otherwise.
  */
-bool Utils::isOnlySpace(const std::string &str)
+bool Utils::isOnlySpace(const StringView& str)
 {
-	for (unsigned long i = 0; i < str.length(); i++)
+	for (unsigned long i = 0; i < str.size; i++)
 		if (std::iswspace(str[i]) == 0)
 			return (false);
 	return (true);
@@ -80,9 +79,9 @@ bool Utils::isOnlySpace(const std::string &str)
  * @param str The input string to be checked.
  * @return true if the string is a printable sentence, false otherwise.
  */
-bool Utils::isPrintableSentence(const std::string &str)
+bool Utils::isPrintableSentence(const StringView& str)
 {
-	for (unsigned long i = 0; i < str.length(); i++)
+	for (unsigned long i = 0; i < str.size; i++)
 	{
 		// Tabulation, vertical tab, form feed
 		if (str[i] == '\t' || str[i] == '\v' || str[i] == '\f')
@@ -90,7 +89,7 @@ bool Utils::isPrintableSentence(const std::string &str)
 
 		// Check les touches directionnelles (flèches)
 		if (str[i] == '\x1b')
-			if (i + 2 < str.length())
+			if (i + 2 < str.size)
 				if (str[i + 1] == '[' && (str[i + 2] == 'A' || str[i + 2] == 'B' || str[i + 2] == 'C' || str[i + 2] == 'D'))
 					return false;
 	}
@@ -212,29 +211,6 @@ std::vector<std::string> Utils::getTokens(const std::string &s, int opt)
 	return tokens;
 }
 
-/**
- * @brief Concatenates elements of a vector from a given iterator to the end of the vector into a single string.
- *
- * This function takes an iterator pointing to a position in a vector of strings and concatenates all elements
- * from that position to the end of the vector into a single string, with each element separated by a space.
- *
- * @param it An iterator pointing to the starting position in the vector from which to begin concatenation.
- * @param vec The vector of strings to concatenate.
- * @return A single string containing all elements from the iterator position to the end of the vector, separated by spaces.
- */
-std::string Utils::stockVector(std::vector<std::string>::iterator it, const std::vector<std::string>& vec)
-{ 
-	std::string res;
-	while (it != vec.end())
-	{
-		if (!res.empty())
-			res += " ";
-		res += *it;
-		it++;
-	}
-	return res;
-}
-
 /**
  * @brief Extracts the first word from the given string argument.
  *